@@ -137,6 +137,14 @@ extern "C" {
  #include <stddef.h>
 #endif
 
+/* Include the declaration of the int64_t type used by the frame timing
+ * functions */
+#if defined(_MSC_VER) && (_MSC_VER < 1600)
+ typedef signed __int64 int64_t;
+#else
+ #include <stdint.h>
+#endif
+
 /* Include the chosen client API headers.
  */
 #if defined(__APPLE_CC__)
@@ -495,6 +503,8 @@ extern "C" {
 #define GLFW_RESIZABLE              0x00020003
 #define GLFW_VISIBLE                0x00020004
 #define GLFW_DECORATED              0x00020005
+#define GLFW_FULLSCREEN_BORDERLESS  0x00020006
+#define GLFW_SWAP_INTERVAL          0x00020007
 
 #define GLFW_RED_BITS               0x00021001
 #define GLFW_GREEN_BITS             0x00021002
@@ -520,6 +530,8 @@ extern "C" {
 #define GLFW_OPENGL_FORWARD_COMPAT  0x00022006
 #define GLFW_OPENGL_DEBUG_CONTEXT   0x00022007
 #define GLFW_OPENGL_PROFILE         0x00022008
+#define GLFW_CONTEXT_NO_ERROR       0x00022009
+#define GLFW_CONTEXT_RELEASE_BEHAVIOR 0x0002200A
 
 #define GLFW_OPENGL_API             0x00030001
 #define GLFW_OPENGL_ES_API          0x00030002
@@ -535,14 +547,25 @@ extern "C" {
 #define GLFW_CURSOR                 0x00033001
 #define GLFW_STICKY_KEYS            0x00033002
 #define GLFW_STICKY_MOUSE_BUTTONS   0x00033003
+#define GLFW_CURSOR_PREDICTION      0x00033004
 
 #define GLFW_CURSOR_NORMAL          0x00034001
 #define GLFW_CURSOR_HIDDEN          0x00034002
 #define GLFW_CURSOR_DISABLED        0x00034003
 
+#define GLFW_PREDICTION_LINEAR      0x00035001
+#define GLFW_PREDICTION_SMOOTHED    0x00035002
+
+#define GLFW_ANY_RELEASE_BEHAVIOR            0
+#define GLFW_RELEASE_BEHAVIOR_FLUSH 0x00036001
+#define GLFW_RELEASE_BEHAVIOR_NONE  0x00036002
+
 #define GLFW_CONNECTED              0x00040001
 #define GLFW_DISCONNECTED           0x00040002
 
+#define GLFW_JOYSTICK_AXIS          0x00050001
+#define GLFW_JOYSTICK_BUTTON        0x00050002
+
 
 /*************************************************************************
  * GLFW API types
@@ -788,6 +811,39 @@ typedef void (* GLFWcharfun)(GLFWwindow*,unsigned int);
  */
 typedef void (* GLFWdropfun)(GLFWwindow*,int,const char**);
 
+/*! @brief The function signature for joystick configuration callbacks.
+ *
+ *  This is the function signature for joystick configuration callback
+ *  functions.
+ *
+ *  @param[in] joy The joystick that was connected or disconnected.
+ *  @param[in] event One of `GLFW_CONNECTED` or `GLFW_DISCONNECTED`.
+ *
+ *  @sa glfwSetJoystickCallback
+ *
+ *  @ingroup input
+ */
+typedef void (* GLFWjoystickfun)(int,int);
+
+/*! @brief The function signature for joystick input callbacks.
+ *
+ *  This is the function signature for joystick input callback functions.
+ *
+ *  @param[in] joy The joystick whose state changed.
+ *  @param[in] type One of `GLFW_JOYSTICK_AXIS` or `GLFW_JOYSTICK_BUTTON`.
+ *  @param[in] index The index of the axis or button that changed, as used by
+ *  @ref glfwGetJoystickAxes and @ref glfwGetJoystickButtons.
+ *  @param[in] value The new axis value, or `GLFW_PRESS` or `GLFW_RELEASE` for
+ *  buttons.
+ *  @param[in] time The time, in the time base of @ref glfwGetTime, at which
+ *  the change occurred.
+ *
+ *  @sa glfwSetJoystickInputCallback
+ *
+ *  @ingroup input
+ */
+typedef void (* GLFWjoystickinputfun)(int,int,int,float,double);
+
 /*! @brief The function signature for monitor configuration callbacks.
  *
  *  This is the function signature for monitor configuration callback functions.
@@ -853,6 +909,96 @@ typedef struct GLFWgammaramp
     unsigned int size;
 } GLFWgammaramp;
 
+/*! @brief Cursor position sample.
+ *
+ *  This describes a single cursor position reported to a window.
+ *
+ *  @sa glfwGetCursorHistory
+ *
+ *  @ingroup input
+ */
+typedef struct GLFWcursorsample
+{
+    /*! The x-coordinate of the cursor, relative to the left edge of the client
+     *  area.
+     */
+    double x;
+    /*! The y-coordinate of the cursor, relative to the top edge of the client
+     *  area.
+     */
+    double y;
+    /*! The time, in seconds and in the same time base as @ref glfwGetTime, at
+     *  which the cursor reached this position.
+     */
+    double time;
+} GLFWcursorsample;
+
+/*! @brief Joystick input sample.
+ *
+ *  This describes a single change of a joystick axis or button.
+ *
+ *  @sa glfwGetJoystickHistory
+ *
+ *  @ingroup input
+ */
+typedef struct GLFWjoysticksample
+{
+    /*! One of `GLFW_JOYSTICK_AXIS` or `GLFW_JOYSTICK_BUTTON`.
+     */
+    int type;
+    /*! The index of the axis or button, as used by @ref glfwGetJoystickAxes
+     *  and @ref glfwGetJoystickButtons.
+     */
+    int index;
+    /*! The new axis value, or `GLFW_PRESS` or `GLFW_RELEASE` for buttons.
+     */
+    float value;
+    /*! The time, in seconds and in the same time base as @ref glfwGetTime, at
+     *  which the change occurred.
+     */
+    double time;
+} GLFWjoysticksample;
+
+/*! @brief Framebuffer configuration.
+ *
+ *  This describes a framebuffer configuration usable by windows.
+ *
+ *  @sa glfwGetFramebufferConfigs
+ *
+ *  @ingroup context
+ */
+typedef struct GLFWfbconfig
+{
+    /*! The bit depths of the color channels.
+     */
+    int redBits;
+    int greenBits;
+    int blueBits;
+    int alphaBits;
+    /*! The bit depths of the depth and stencil buffers.
+     */
+    int depthBits;
+    int stencilBits;
+    /*! The bit depths of the accumulation buffer channels.
+     */
+    int accumRedBits;
+    int accumGreenBits;
+    int accumBlueBits;
+    int accumAlphaBits;
+    /*! The number of auxiliary buffers.
+     */
+    int auxBuffers;
+    /*! `GL_TRUE` if the config supports stereoscopic rendering.
+     */
+    int stereo;
+    /*! The number of samples per pixel, or zero if not multisampled.
+     */
+    int samples;
+    /*! `GL_TRUE` if the config is sRGB capable.
+     */
+    int sRGB;
+} GLFWfbconfig;
+
 
 /*************************************************************************
  * GLFW API functions
@@ -1081,8 +1227,8 @@ GLFWAPI const char* glfwGetMonitorName(GLFWmonitor* monitor);
  *  @return The previously set callback, or `NULL` if no callback was set or an
  *  error occurred.
  *
- *  @bug **X11:** This callback is not yet called on monitor configuration
- *  changes.
+ *  @note **X11:** Windows that were fullscreen on a disconnected monitor are
+ *  moved to the primary monitor.
  *
  *  @ingroup monitor
  */
@@ -1130,10 +1276,41 @@ GLFWAPI const GLFWvidmode* glfwGetVideoModes(GLFWmonitor* monitor, int* count);
  */
 GLFWAPI const GLFWvidmode* glfwGetVideoMode(GLFWmonitor* monitor);
 
+/*! @brief Returns the exact refresh rate of the current mode of the specified
+ *  monitor.
+ *
+ *  This function returns the refresh rate of the current video mode of the
+ *  specified monitor as a reduced fraction, in Hz.  Unlike the rounded
+ *  `refreshRate` member of @ref GLFWvidmode, this is suitable for frame pacing
+ *  on displays running at rates such as 59.94 Hz.
+ *
+ *  If the exact rate cannot be determined, the numerator is set to zero and
+ *  the denominator to one.
+ *
+ *  @param[in] monitor The monitor to query.
+ *  @param[out] numerator Where to store the numerator of the refresh rate, or
+ *  `NULL`.
+ *  @param[out] denominator Where to store the denominator of the refresh rate,
+ *  or `NULL`.
+ *
+ *  @note **X11:** The rate is calculated from the pixel clock and total
+ *  dimensions of the current mode, taking interlacing and double scanning into
+ *  account.
+ *
+ *  @bug **Windows:** The rate reported by the system is an integer, so the
+ *  denominator is always one.
+ *
+ *  @sa glfwGetVideoMode
+ *
+ *  @ingroup monitor
+ */
+GLFWAPI void glfwGetVideoModeRefreshRational(GLFWmonitor* monitor, int* numerator, int* denominator);
+
 /*! @brief Generates a gamma ramp and sets it for the specified monitor.
  *
- *  This function generates a 256-element gamma ramp from the specified exponent
- *  and then calls @ref glfwSetGammaRamp with it.
+ *  This function generates a gamma ramp from the specified exponent, with as
+ *  many elements as the hardware ramp of the monitor, and then calls @ref
+ *  glfwSetGammaRamp with it.
  *
  *  @param[in] monitor The monitor whose gamma ramp to set.
  *  @param[in] gamma The desired exponent.
@@ -1152,6 +1329,9 @@ GLFWAPI void glfwSetGamma(GLFWmonitor* monitor, float gamma);
  *  @note The value arrays of the returned ramp are allocated and freed by GLFW.
  *  You should not free them yourself.
  *
+ *  @note The returned ramp is the one last set with @ref glfwSetGammaRamp, if
+ *  any, and is cached until the platform reports a change to the monitor.
+ *
  *  @ingroup monitor
  */
 GLFWAPI const GLFWgammaramp* glfwGetGammaRamp(GLFWmonitor* monitor);
@@ -1165,6 +1345,9 @@ GLFWAPI const GLFWgammaramp* glfwGetGammaRamp(GLFWmonitor* monitor);
  *
  *  @note Gamma ramp sizes other than 256 are not supported by all hardware.
  *
+ *  @note **X11:** Ramps are resampled to the size of the hardware ramp when
+ *  using RandR.
+ *
  *  @ingroup monitor
  */
 GLFWAPI void glfwSetGammaRamp(GLFWmonitor* monitor, const GLFWgammaramp* ramp);
@@ -1272,6 +1455,38 @@ GLFWAPI void glfwWindowHint(int target, int hint);
  */
 GLFWAPI GLFWwindow* glfwCreateWindow(int width, int height, const char* title, GLFWmonitor* monitor, GLFWwindow* share);
 
+/*! @brief Creates a context without a window.
+ *
+ *  This function creates a context that has no window and no presence in the
+ *  window system, for example for uploading resources on a worker thread.  The
+ *  context and framebuffer hints are applied as for @ref glfwCreateWindow.
+ *
+ *  The returned handle may only be used with context related functions, such
+ *  as @ref glfwMakeContextCurrent, @ref glfwGetProcAddress and the context
+ *  attributes of @ref glfwGetWindowAttrib, as well as with @ref
+ *  glfwDestroyWindow and the window user pointer functions.  @ref
+ *  glfwSwapBuffers and @ref glfwSwapInterval do nothing for offscreen contexts.
+ *
+ *  The framebuffer of an offscreen context is not meant to be drawn to.  Render
+ *  to framebuffer objects instead.
+ *
+ *  @param[in] share The window whose context to share resources with, or `NULL`
+ *  to not share resources.
+ *  @return The handle of the created context, or `NULL` if an error occurred.
+ *
+ *  @remarks **X11:** The context uses a 1x1 GLX pbuffer as its drawable.
+ *
+ *  @remarks **Windows, OS X and EGL:** Offscreen contexts are not yet
+ *  supported and this function emits `GLFW_API_UNAVAILABLE`.
+ *
+ *  @note This function may only be called from the main thread.
+ *
+ *  @sa glfwDestroyWindow
+ *
+ *  @ingroup context
+ */
+GLFWAPI GLFWwindow* glfwCreateOffscreenContext(GLFWwindow* share);
+
 /*! @brief Destroys the specified window and its context.
  *
  *  This function destroys the specified window and its context.  On calling
@@ -1782,8 +1997,8 @@ GLFWAPI void glfwPostEmptyEvent(void);
 /*! @brief Returns the value of an input option for the specified window.
  *
  *  @param[in] window The window to query.
- *  @param[in] mode One of `GLFW_CURSOR`, `GLFW_STICKY_KEYS` or
- *  `GLFW_STICKY_MOUSE_BUTTONS`.
+ *  @param[in] mode One of `GLFW_CURSOR`, `GLFW_STICKY_KEYS`,
+ *  `GLFW_STICKY_MOUSE_BUTTONS` or `GLFW_CURSOR_PREDICTION`.
  *
  *  @sa glfwSetInputMode
  *
@@ -1793,8 +2008,8 @@ GLFWAPI int glfwGetInputMode(GLFWwindow* window, int mode);
 
 /*! @brief Sets an input option for the specified window.
  *  @param[in] window The window whose input mode to set.
- *  @param[in] mode One of `GLFW_CURSOR`, `GLFW_STICKY_KEYS` or
- *  `GLFW_STICKY_MOUSE_BUTTONS`.
+ *  @param[in] mode One of `GLFW_CURSOR`, `GLFW_STICKY_KEYS`,
+ *  `GLFW_STICKY_MOUSE_BUTTONS` or `GLFW_CURSOR_PREDICTION`.
  *  @param[in] value The new value of the specified input mode.
  *
  *  If `mode` is `GLFW_CURSOR`, the value must be one of the supported input
@@ -1823,6 +2038,14 @@ GLFWAPI int glfwGetInputMode(GLFWwindow* window, int mode);
  *  you are only interested in whether mouse buttons have been pressed but not
  *  when or in which order.
  *
+ *  If `mode` is `GLFW_CURSOR_PREDICTION`, the value must be one of the
+ *  supported filters used by @ref glfwGetPredictedCursorPos:
+ *  - `GLFW_PREDICTION_LINEAR` extrapolates along a line fitted to the most
+ *    recent cursor samples.  This is the default.
+ *  - `GLFW_PREDICTION_SMOOTHED` runs the recent samples through an alpha-beta
+ *    filter before extrapolating, trading some responsiveness for less
+ *    jitter.
+ *
  *  @sa glfwGetInputMode
  *
  *  @ingroup input
@@ -1924,6 +2147,61 @@ GLFWAPI void glfwGetCursorPos(GLFWwindow* window, double* xpos, double* ypos);
  */
 GLFWAPI void glfwSetCursorPos(GLFWwindow* window, double xpos, double ypos);
 
+/*! @brief Retrieves the cursor positions reported since the last call.
+ *
+ *  This function copies the cursor positions reported to the specified window
+ *  since the last call to this function, oldest first, into the specified
+ *  array.  Unlike @ref glfwGetCursorPos, this provides every intermediate
+ *  position received during a frame, each with the time it was reported.
+ *
+ *  If more samples are pending than fit in the array, the oldest ones are
+ *  returned and the rest are kept for the next call.  GLFW only keeps a limited
+ *  number of samples per window, so if this function is not called often
+ *  enough the oldest samples are discarded.
+ *
+ *  The positions are in the same coordinate space as those returned by @ref
+ *  glfwGetCursorPos, including when the cursor is disabled.
+ *
+ *  @param[in] window The desired window.
+ *  @param[out] samples Where to store the cursor samples.
+ *  @param[in] capacity The number of elements in the `samples` array.
+ *  @return The number of samples stored, or zero if no samples were pending
+ *  or an error occurred.
+ *
+ *  @sa glfwGetCursorPos
+ *
+ *  @ingroup input
+ */
+GLFWAPI int glfwGetCursorHistory(GLFWwindow* window, GLFWcursorsample* samples, int capacity);
+
+/*! @brief Predicts the cursor position at the specified time.
+ *
+ *  This function extrapolates the position of the cursor, in screen
+ *  coordinates relative to the upper-left corner of the client area of the
+ *  specified window, at the specified time.  This lets a renderer draw the
+ *  cursor where it will be when the frame is presented instead of where it was
+ *  when input was last polled.
+ *
+ *  The prediction is based on the recent cursor samples of the window, using
+ *  the filter selected with the `GLFW_CURSOR_PREDICTION` input mode.  Reading
+ *  the samples with @ref glfwGetCursorHistory does not affect the prediction.
+ *  If the cursor has not moved recently, the last reported position is
+ *  returned.
+ *
+ *  @param[in] window The desired window.
+ *  @param[in] time The time, in the time base of @ref glfwGetTime, for which
+ *  to predict the cursor position.
+ *  @param[out] xpos Where to store the predicted cursor x-coordinate, or
+ *  `NULL`.
+ *  @param[out] ypos Where to store the predicted cursor y-coordinate, or
+ *  `NULL`.
+ *
+ *  @sa glfwGetCursorPos glfwGetCursorHistory
+ *
+ *  @ingroup input
+ */
+GLFWAPI void glfwGetPredictedCursorPos(GLFWwindow* window, double time, double* xpos, double* ypos);
+
 /*! @brief Sets the key callback.
  *
  *  This function sets the key callback of the specific window, which is called
@@ -2073,6 +2351,9 @@ GLFWAPI GLFWdropfun glfwSetDropCallback(GLFWwindow* window, GLFWdropfun cbfun);
  *  @param[in] joy The joystick to query.
  *  @return `GL_TRUE` if the joystick is present, or `GL_FALSE` otherwise.
  *
+ *  @note **X11:** Joystick state is only updated by @ref glfwPollEvents and
+ *  @ref glfwWaitEvents.
+ *
  *  @ingroup input
  */
 GLFWAPI int glfwJoystickPresent(int joy);
@@ -2092,6 +2373,9 @@ GLFWAPI int glfwJoystickPresent(int joy);
  *  @note The returned array is valid only until the next call to @ref
  *  glfwGetJoystickAxes for that joystick.
  *
+ *  @note **X11:** Joystick state is only updated by @ref glfwPollEvents and
+ *  @ref glfwWaitEvents.
+ *
  *  @ingroup input
  */
 GLFWAPI const float* glfwGetJoystickAxes(int joy, int* count);
@@ -2111,6 +2395,9 @@ GLFWAPI const float* glfwGetJoystickAxes(int joy, int* count);
  *  @note The returned array is valid only until the next call to @ref
  *  glfwGetJoystickButtons for that joystick.
  *
+ *  @note **X11:** Joystick state is only updated by @ref glfwPollEvents and
+ *  @ref glfwWaitEvents.
+ *
  *  @ingroup input
  */
 GLFWAPI const unsigned char* glfwGetJoystickButtons(int joy, int* count);
@@ -2133,6 +2420,112 @@ GLFWAPI const unsigned char* glfwGetJoystickButtons(int joy, int* count);
  */
 GLFWAPI const char* glfwGetJoystickName(int joy);
 
+/*! @brief Sets the joystick configuration callback.
+ *
+ *  This function sets the joystick configuration callback, or removes the
+ *  currently set callback.  This is called when a joystick is connected to or
+ *  disconnected from the system.
+ *
+ *  @param[in] cbfun The new callback, or `NULL` to remove the currently set
+ *  callback.
+ *  @return The previously set callback, or `NULL` if no callback was set or an
+ *  error occurred.
+ *
+ *  @note This callback is called from within @ref glfwPollEvents and @ref
+ *  glfwWaitEvents.
+ *
+ *  @bug **Windows:** **OS X:** This callback is not yet called.
+ *
+ *  @ingroup input
+ */
+GLFWAPI GLFWjoystickfun glfwSetJoystickCallback(GLFWjoystickfun cbfun);
+
+/*! @brief Sets the joystick input callback.
+ *
+ *  This function sets the joystick input callback, or removes the currently
+ *  set callback.  This is called once for every change of an axis or button
+ *  of any joystick, in the order the changes occurred, including changes that
+ *  were undone again before the next call to @ref glfwPollEvents.
+ *
+ *  @param[in] cbfun The new callback, or `NULL` to remove the currently set
+ *  callback.
+ *  @return The previously set callback, or `NULL` if no callback was set or an
+ *  error occurred.
+ *
+ *  @note This callback is called from within @ref glfwPollEvents and @ref
+ *  glfwWaitEvents.
+ *
+ *  @note **X11:** The time of each change is taken from the kernel event
+ *  timestamp.  If the joystick device clock cannot be made to match the one
+ *  used by @ref glfwGetTime, the time at which the event was read is used
+ *  instead.
+ *
+ *  @bug **Windows:** **OS X:** This callback is not yet called.
+ *
+ *  @ingroup input
+ */
+GLFWAPI GLFWjoystickinputfun glfwSetJoystickInputCallback(GLFWjoystickinputfun cbfun);
+
+/*! @brief Enables or disables background joystick sampling.
+ *
+ *  This function starts or stops a background thread that reads joystick input
+ *  as soon as it arrives, instead of when events are processed.  This lets
+ *  @ref glfwGetJoystickHistory provide every change at the full rate reported
+ *  by the device, independently of how often the main thread processes events.
+ *
+ *  The state returned by @ref glfwGetJoystickAxes and @ref
+ *  glfwGetJoystickButtons and the joystick callbacks are still updated by
+ *  @ref glfwPollEvents and @ref glfwWaitEvents on the main thread.
+ *
+ *  Sampling is disabled by default and is stopped by @ref glfwTerminate.
+ *
+ *  @param[in] enabled `GL_TRUE` to enable background sampling, or `GL_FALSE`
+ *  to disable it.
+ *
+ *  @note This function may only be called from the main thread.
+ *
+ *  @bug **Windows:** **OS X:** Background sampling is not yet supported.
+ *
+ *  @sa glfwGetJoystickHistory
+ *
+ *  @ingroup input
+ */
+GLFWAPI void glfwSetJoystickSampling(int enabled);
+
+/*! @brief Retrieves the joystick input recorded since the last call.
+ *
+ *  This function copies the axis and button changes of the specified joystick
+ *  recorded since the last call to this function, oldest first, into the
+ *  specified array.
+ *
+ *  If more samples are pending than fit in the array, the oldest ones are
+ *  returned and the rest are kept for the next call.  GLFW only keeps a limited
+ *  number of samples per joystick, so if this function is not called often
+ *  enough the oldest samples are discarded.
+ *
+ *  Without background sampling, changes are recorded when events are processed.
+ *  With it enabled, they are recorded as soon as they arrive.  No changes are
+ *  recorded until joysticks have been detected by a joystick function called
+ *  on the main thread, such as @ref glfwJoystickPresent.
+ *
+ *  @param[in] joy The joystick to query.
+ *  @param[out] samples Where to store the joystick samples.
+ *  @param[in] capacity The number of elements in the `samples` array.
+ *  @return The number of samples stored, or zero if no samples were pending
+ *  or an error occurred.
+ *
+ *  @note This function may be called from any thread.  The recorded samples
+ *  are shared by all callers, so each sample is returned to only one of them.
+ *  It never waits for the background sampling thread.
+ *
+ *  @bug **Windows:** **OS X:** No samples are recorded yet.
+ *
+ *  @sa glfwSetJoystickSampling
+ *
+ *  @ingroup input
+ */
+GLFWAPI int glfwGetJoystickHistory(int joy, GLFWjoysticksample* samples, int capacity);
+
 /*! @brief Sets the clipboard to the specified string.
  *
  *  This function sets the system clipboard to the specified, UTF-8 encoded
@@ -2224,6 +2617,38 @@ GLFWAPI void glfwSetTime(double time);
  */
 GLFWAPI void glfwMakeContextCurrent(GLFWwindow* window);
 
+/*! @brief Makes the context of one window current on the framebuffer of
+ *  another.
+ *
+ *  This function makes the context of the specified window current on the
+ *  calling thread, rendering to the framebuffer of the target window instead
+ *  of its own.  This lets a single context draw to many windows without
+ *  switching between their contexts.
+ *
+ *  The framebuffer of the target window must be compatible with that of the
+ *  context window, which is the case if they were created with the same
+ *  framebuffer hints.  If they are not compatible, a `GLFW_INVALID_VALUE`
+ *  error is generated and the current context is left unchanged.
+ *
+ *  While the context is current on the target window, @ref glfwSwapBuffers
+ *  should be called with the target window.  If the target window is
+ *  destroyed on the calling thread, the context is detached.
+ *
+ *  @param[in] context The window whose context to make current, or `NULL` to
+ *  detach the current context.
+ *  @param[in] target The window whose framebuffer to render to, or `NULL` to
+ *  render to the framebuffer of the context window.
+ *
+ *  @remarks This function may be called from secondary threads.
+ *
+ *  @note This function is currently only supported by GLX and EGL.
+ *
+ *  @sa glfwMakeContextCurrent
+ *
+ *  @ingroup context
+ */
+GLFWAPI void glfwMakeContextCurrentOn(GLFWwindow* context, GLFWwindow* target);
+
 /*! @brief Returns the window whose context is current on the calling thread.
  *
  *  This function returns the window whose context is current on the calling
@@ -2250,6 +2675,11 @@ GLFWAPI GLFWwindow* glfwGetCurrentContext(void);
  *
  *  @remarks This function may be called from secondary threads.
  *
+ *  @note If the buffers of the window were last swapped by @ref
+ *  glfwSwapBuffersMulti and the system can only set the swap interval of the
+ *  current context, the context is briefly made current on the calling thread
+ *  to restore its swap interval, so it must not be current on other threads.
+ *
  *  @par New in GLFW 3
  *  This function no longer calls @ref glfwPollEvents.  You need to call it or
  *  @ref glfwWaitEvents yourself.
@@ -2260,6 +2690,36 @@ GLFWAPI GLFWwindow* glfwGetCurrentContext(void);
  */
 GLFWAPI void glfwSwapBuffers(GLFWwindow* window);
 
+/*! @brief Swaps the front and back buffers of several windows.
+ *
+ *  This function swaps the front and back buffers of the specified windows, in
+ *  order, waiting for at most one vertical retrace.  Swapping the windows one
+ *  by one with @ref glfwSwapBuffers may wait for a retrace for each window.
+ *
+ *  The first window is swapped with the swap interval of largest magnitude
+ *  among the windows, while the rest are swapped without waiting.  The swap
+ *  intervals applied to the windows are changed accordingly, which on systems
+ *  that can only set the swap interval of the current context requires making
+ *  their contexts current on the calling thread the first time.  The
+ *  previously current context is then restored.  The intervals set with @ref
+ *  glfwSwapInterval are not changed and are applied again by @ref
+ *  glfwSwapBuffers.
+ *
+ *  @param[in] windows The windows whose buffers to swap.
+ *  @param[in] count The number of windows in the array.
+ *
+ *  @note The contexts of the windows must not be current on other threads.
+ *
+ *  @note Rendering to a window must have been flushed, for example by making
+ *  another context current, before its buffers are swapped by this function.
+ *
+ *  @sa glfwSwapBuffers
+ *  @sa glfwSwapInterval
+ *
+ *  @ingroup context
+ */
+GLFWAPI void glfwSwapBuffersMulti(GLFWwindow** windows, int count);
+
 /*! @brief Sets the swap interval for the current context.
  *
  *  This function sets the swap interval for the current context, i.e. the
@@ -2272,7 +2732,14 @@ GLFWAPI void glfwSwapBuffers(GLFWwindow* window);
  *  which allow the driver to swap even if a frame arrives a little bit late.
  *  You can check for the presence of these extensions using @ref
  *  glfwExtensionSupported.  For more information about swap tearing, see the
- *  extension specifications.
+ *  extension specifications.  Without these extensions, negative intervals
+ *  select regular vertical synchronization with the absolute value of the
+ *  interval.
+ *
+ *  The interval actually applied to the framebuffer of the window the context
+ *  renders to can be retrieved with the `GLFW_SWAP_INTERVAL` window attribute.
+ *  Before this function has been called, the interval of a window is unknown
+ *  unless the system reports it.
  *
  *  @param[in] interval The minimum number of screen updates to wait for
  *  until the buffers are swapped by @ref glfwSwapBuffers.
@@ -2294,6 +2761,56 @@ GLFWAPI void glfwSwapBuffers(GLFWwindow* window);
  */
 GLFWAPI void glfwSwapInterval(int interval);
 
+/*! @brief Retrieves the frame timing of the specified window.
+ *
+ *  This function retrieves the unadjusted system time (UST) of the most recent
+ *  vertical retrace of the screen showing the specified window, the media
+ *  stream counter (MSC) counting those retraces and the swap buffer counter
+ *  (SBC) counting the buffer swaps of the window that have completed.  An
+ *  increase in the MSC of more than the swap interval between two frames
+ *  indicates a missed vertical retrace.
+ *
+ *  If the system provides these values, the UST is in microseconds of
+ *  a system-specific clock.  Otherwise they are estimated from the GLFW timer
+ *  and the refresh rate of the monitor, the UST is then in microseconds of
+ *  the GLFW timer and the SBC counts calls to @ref glfwSwapBuffers.
+ *
+ *  Any or all of the value pointers may be `NULL`.
+ *
+ *  @param[in] window The window to query.
+ *  @param[out] ust Where to store the UST, in microseconds, or `NULL`.
+ *  @param[out] msc Where to store the MSC, or `NULL`.
+ *  @param[out] sbc Where to store the SBC, or `NULL`.
+ *  @return `GL_TRUE` if the values were provided by the system, or `GL_FALSE`
+ *  if they were estimated or an error occurred.
+ *
+ *  @note The values are only provided by the system with GLX, if the
+ *  `GLX_OML_sync_control` extension is available.
+ *
+ *  @sa glfwWaitForMSC
+ *
+ *  @ingroup context
+ */
+GLFWAPI int glfwGetFrameTiming(GLFWwindow* window, int64_t* ust, int64_t* msc, int64_t* sbc);
+
+/*! @brief Waits until the media stream counter reaches the specified value.
+ *
+ *  This function blocks until the media stream counter (MSC) of the screen
+ *  showing the specified window reaches the specified value.  If the system
+ *  does not provide the MSC, this function instead sleeps until the estimated
+ *  time of that value as reported by @ref glfwGetFrameTiming.
+ *
+ *  @param[in] window The window whose screen to wait for.
+ *  @param[in] msc The MSC value to wait for.
+ *  @return `GL_TRUE` if the wait was performed by the system, or `GL_FALSE`
+ *  if it was estimated or an error occurred.
+ *
+ *  @sa glfwGetFrameTiming
+ *
+ *  @ingroup context
+ */
+GLFWAPI int glfwWaitForMSC(GLFWwindow* window, int64_t msc);
+
 /*! @brief Returns whether the specified extension is available.
  *
  *  This function returns whether the specified
@@ -2306,15 +2823,57 @@ GLFWAPI void glfwSwapInterval(int interval);
  *
  *  @remarks This function may be called from secondary threads.
  *
- *  @note As this functions searches one or more extension strings on each call,
- *  it is recommended that you cache its results if it's going to be used
- *  frequently.  The extension strings will not change during the lifetime of
- *  a context, so there is no danger in doing this.
+ *  @note The extensions of each context are hashed when it is created, so this
+ *  function does not search the extension strings on each call.
+ *
+ *  @sa glfwExtensionsSupported
  *
  *  @ingroup context
  */
 GLFWAPI int glfwExtensionSupported(const char* extension);
 
+/*! @brief Returns whether each of the specified extensions is available.
+ *
+ *  This function checks each of the specified
+ *  [OpenGL or context creation API extensions](@ref context_glext) in the same
+ *  way as @ref glfwExtensionSupported, for applications that probe many
+ *  extensions at once.
+ *
+ *  @param[in] extensions An array of ASCII encoded extension names.
+ *  @param[out] results An array where `GL_TRUE` or `GL_FALSE` is stored for
+ *  each extension.
+ *  @param[in] count The number of elements in the arrays.
+ *
+ *  @remarks This function may be called from secondary threads.
+ *
+ *  @note If an error occurs, every element of `results` is set to `GL_FALSE`.
+ *
+ *  @sa glfwExtensionSupported
+ *
+ *  @ingroup context
+ */
+GLFWAPI void glfwExtensionsSupported(const char** extensions, int* results, int count);
+
+/*! @brief Returns the usable framebuffer configurations.
+ *
+ *  This function returns an array of all framebuffer configurations that
+ *  windows may use, as seen by the context creation API.  The window hints
+ *  are matched against these when a window is created.
+ *
+ *  @param[out] count Where to store the number of configurations in the
+ *  returned array.  This is set to zero if an error occurred.
+ *  @return An array of framebuffer configurations, or `NULL` if an error
+ *  occurred or the configurations cannot be enumerated.
+ *
+ *  @note The returned array is allocated and freed by GLFW.  You should not
+ *  free it yourself.  It is valid until the library is terminated.
+ *
+ *  @note Framebuffer configurations are only enumerated with GLX and EGL.
+ *
+ *  @ingroup context
+ */
+GLFWAPI const GLFWfbconfig* glfwGetFramebufferConfigs(int* count);
+
 /*! @brief Returns the address of the specified function for the current
  *  context.
  *
@@ -2332,10 +2891,43 @@ GLFWAPI int glfwExtensionSupported(const char* extension);
  *  all contexts, especially if they use different client APIs or even different
  *  context creation hints.
  *
+ *  @note Function addresses are cached per share group, so looking up the same
+ *  function again is cheap.
+ *
+ *  @sa glfwLoadProcs
+ *
  *  @ingroup context
  */
 GLFWAPI GLFWglproc glfwGetProcAddress(const char* procname);
 
+/*! @brief Retrieves the addresses of the specified functions for the current
+ *  context.
+ *
+ *  This function retrieves the addresses of the specified
+ *  [client API or extension functions](@ref context_glext) in the same way as
+ *  @ref glfwGetProcAddress, for loaders that resolve whole tables of functions.
+ *
+ *  The addresses are cached and shared by all contexts in the same share group
+ *  and by contexts with the same client API, profile, pixel format, vendor,
+ *  renderer and version, so loading the same table for a later context is
+ *  cheap.
+ *
+ *  @param[in] procnames An array of ASCII encoded function names.
+ *  @param[out] procs An array where the address of each function, or `NULL`
+ *  if it is unavailable, is stored.
+ *  @param[in] count The number of elements in the arrays.
+ *  @return The number of functions that were found.
+ *
+ *  @remarks This function may be called from secondary threads.
+ *
+ *  @note If an error occurs, every element of `procs` is set to `NULL`.
+ *
+ *  @sa glfwGetProcAddress
+ *
+ *  @ingroup context
+ */
+GLFWAPI int glfwLoadProcs(const char** procnames, GLFWglproc* procs, int count);
+
 
 /*************************************************************************
  * Global definition cleanup
@@ -501,3 +501,17 @@ const char* _glfwPlatformGetJoystickName(int joy)
     return _glfw.ns.joysticks[joy].name;
 }
 
+void _glfwPlatformSetJoystickSampling(int enabled)
+{
+    if (enabled)
+    {
+        _glfwInputError(GLFW_PLATFORM_ERROR,
+                        "Cocoa: Background joystick sampling is not supported");
+    }
+}
+
+int _glfwPlatformGetJoystickHistory(int joy, GLFWjoysticksample* samples, int capacity)
+{
+    return 0;
+}
+
@@ -402,6 +402,35 @@ void _glfwPlatformGetVideoMode(_GLFWmonitor* monitor, GLFWvidmode *mode)
     CVDisplayLinkRelease(link);
 }
 
+void _glfwPlatformGetVideoModeRefreshRational(_GLFWmonitor* monitor,
+                                              unsigned long* numerator,
+                                              unsigned long* denominator)
+{
+    CVDisplayLinkRef link;
+    CVTime time;
+
+    CVDisplayLinkCreateWithCGDisplay(monitor->ns.displayID, &link);
+    time = CVDisplayLinkGetNominalOutputVideoRefreshPeriod(link);
+    CVDisplayLinkRelease(link);
+
+    if (!(time.flags & kCVTimeIsIndefinite) &&
+        time.timeValue > 0 && time.timeScale > 0)
+    {
+        // The nominal refresh period is the inverse of the rate
+        *numerator = (unsigned long) time.timeScale;
+        *denominator = (unsigned long) time.timeValue;
+    }
+    else
+    {
+        CGDisplayModeRef displayMode;
+
+        displayMode = CGDisplayCopyDisplayMode(monitor->ns.displayID);
+        *numerator = (unsigned long) (CGDisplayModeGetRefreshRate(displayMode) * 1000.0 + 0.5);
+        *denominator = 1000;
+        CGDisplayModeRelease(displayMode);
+    }
+}
+
 
 //////////////////////////////////////////////////////////////////////////
 //////                        GLFW native API                       //////
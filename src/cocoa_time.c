@@ -27,6 +27,8 @@
 #include "internal.h"
 
 #include <mach/mach_time.h>
+#include <time.h>
+#include <errno.h>
 
 
 // Return raw time
@@ -69,3 +71,15 @@ void _glfwPlatformSetTime(double time)
         (uint64_t) (time / _glfw.ns.timer.resolution);
 }
 
+void _glfwPlatformSleep(double seconds)
+{
+    struct timespec ts;
+
+    ts.tv_sec = (time_t) seconds;
+    ts.tv_nsec = (long) ((seconds - (double) ts.tv_sec) * 1e9);
+
+    // Continue sleeping for the remaining time if interrupted by a signal
+    while (nanosleep(&ts, &ts) == -1 && errno == EINTR)
+        ;
+}
+
@@ -501,14 +501,16 @@ static int translateKey(unsigned int key)
 
 - (void)mouseMoved:(NSEvent *)event
 {
+    const double time = _glfwPlatformGetTime();
+
     if (window->cursorMode == GLFW_CURSOR_DISABLED)
-        _glfwInputCursorMotion(window, [event deltaX], [event deltaY]);
+        _glfwInputCursorMotion(window, [event deltaX], [event deltaY], time);
     else
     {
         const NSRect contentRect = [window->ns.view frame];
         const NSPoint p = [event locationInWindow];
 
-        _glfwInputCursorMotion(window, p.x, contentRect.size.height - p.y);
+        _glfwInputCursorMotion(window, p.x, contentRect.size.height - p.y, time);
     }
 }
 
@@ -694,7 +696,8 @@ static int translateKey(unsigned int key)
     _glfwPlatformGetWindowSize(window, NULL, &height);
     _glfwInputCursorMotion(window,
                            [sender draggingLocation].x,
-                           height - [sender draggingLocation].y);
+                           height - [sender draggingLocation].y,
+                           _glfwPlatformGetTime());
 
     const int count = [files count];
     if (count)
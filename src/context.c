@@ -29,9 +29,306 @@
 
 #include <stdio.h>
 #include <string.h>
+#include <stdlib.h>
 #include <limits.h>
 #include <stdio.h>
 
+#ifndef GL_CONTEXT_FLAG_NO_ERROR_BIT_KHR
+ #define GL_CONTEXT_FLAG_NO_ERROR_BIT_KHR 0x00000008
+#endif
+
+#ifndef GL_KHR_context_flush_control
+ #define GL_CONTEXT_RELEASE_BEHAVIOR 0x82fb
+ #define GL_CONTEXT_RELEASE_BEHAVIOR_FLUSH 0x82fc
+#endif
+
+
+// Returns the FNV-1a hash of the specified string
+//
+static unsigned int hashString(const char* string)
+{
+    unsigned int hash = 2166136261u;
+
+    while (*string)
+    {
+        hash ^= (unsigned char) *string++;
+        hash *= 16777619u;
+    }
+
+    return hash;
+}
+
+// Adds the specified extension name to the set, unless already present
+//
+static void insertExtension(_GLFWextensions* set, const char* name)
+{
+    const unsigned int mask = set->size - 1;
+    unsigned int index = hashString(name) & mask;
+
+    while (set->buckets[index])
+    {
+        if (strcmp(set->buckets[index], name) == 0)
+            return;
+
+        index = (index + 1) & mask;
+    }
+
+    set->buckets[index] = name;
+}
+
+// Builds the extension set of the current context of the specified window
+// Failures are reported and leave the set empty, as the context is still
+// usable without it
+//
+static void refreshExtensions(_GLFWwindow* window)
+{
+    const GLubyte* extensions;
+
+    _glfwFreeExtensionSet(&window->context.extensions);
+
+#if defined(_GLFW_USE_OPENGL)
+    if (window->context.major > 2)
+    {
+        int i;
+        GLint count = 0;
+        size_t length = 1;
+        char* string;
+        char* end;
+        const char** names;
+
+        // The modern extension list is joined into a string so that both
+        // kinds of context share a single code path for building the set
+
+        glGetIntegerv(GL_NUM_EXTENSIONS, &count);
+
+        names = calloc(count + 1, sizeof(char*));
+        if (!names)
+        {
+            _glfwInputError(GLFW_OUT_OF_MEMORY, NULL);
+            return;
+        }
+
+        for (i = 0;  i < count;  i++)
+        {
+            names[i] = (const char*) window->GetStringi(GL_EXTENSIONS, i);
+            if (!names[i])
+            {
+                _glfwInputError(GLFW_PLATFORM_ERROR,
+                                "Failed to retrieve extension string %i", i);
+                free(names);
+                return;
+            }
+
+            length += strlen(names[i]) + 1;
+        }
+
+        string = calloc(length, 1);
+        if (!string)
+        {
+            _glfwInputError(GLFW_OUT_OF_MEMORY, NULL);
+            free(names);
+            return;
+        }
+
+        end = string;
+
+        for (i = 0;  i < count;  i++)
+        {
+            const size_t nameLength = strlen(names[i]);
+            memcpy(end, names[i], nameLength);
+            end += nameLength;
+            *end++ = ' ';
+        }
+
+        if (!_glfwInitExtensionSet(&window->context.extensions, string))
+            _glfwInputError(GLFW_OUT_OF_MEMORY, NULL);
+
+        free(string);
+        free(names);
+        return;
+    }
+#endif // _GLFW_USE_OPENGL
+
+    extensions = glGetString(GL_EXTENSIONS);
+    if (!extensions)
+    {
+        _glfwInputError(GLFW_PLATFORM_ERROR,
+                        "Failed to retrieve extension string");
+        return;
+    }
+
+    if (!_glfwInitExtensionSet(&window->context.extensions,
+                               (const char*) extensions))
+    {
+        _glfwInputError(GLFW_OUT_OF_MEMORY, NULL);
+    }
+}
+
+// Doubles the size of the hash table of the specified function pointer cache
+//
+static GLboolean growProcCache(_GLFWproccache* cache)
+{
+    unsigned int i, index;
+    const unsigned int size = cache->size ? cache->size * 2 : 64;
+    char** names = calloc(size, sizeof(char*));
+    GLFWglproc* procs = calloc(size, sizeof(GLFWglproc));
+
+    if (!names || !procs)
+    {
+        free(names);
+        free(procs);
+        return GL_FALSE;
+    }
+
+    for (i = 0;  i < cache->size;  i++)
+    {
+        if (!cache->names[i])
+            continue;
+
+        index = hashString(cache->names[i]) & (size - 1);
+        while (names[index])
+            index = (index + 1) & (size - 1);
+
+        names[index] = cache->names[i];
+        procs[index] = cache->procs[i];
+    }
+
+    free(cache->names);
+    free(cache->procs);
+
+    cache->names = names;
+    cache->procs = procs;
+    cache->size = size;
+    return GL_TRUE;
+}
+
+// Returns the function pointer for the specified name from the cache, resolving
+// and adding it if necessary
+// The proc cache lock must be held by the caller
+//
+static GLFWglproc getCachedProc(_GLFWproccache* cache, const char* procname)
+{
+    unsigned int index;
+    GLFWglproc proc;
+
+    if (!cache)
+        return _glfwPlatformGetProcAddress(procname);
+
+    if (cache->size)
+    {
+        index = hashString(procname) & (cache->size - 1);
+        while (cache->names[index])
+        {
+            if (strcmp(cache->names[index], procname) == 0)
+                return cache->procs[index];
+
+            index = (index + 1) & (cache->size - 1);
+        }
+    }
+
+    // Missing functions are cached as well, as loaders often probe for them
+
+    proc = _glfwPlatformGetProcAddress(procname);
+
+    if ((cache->count + 1) * 2 > cache->size)
+    {
+        if (!growProcCache(cache))
+            return proc;
+    }
+
+    index = hashString(procname) & (cache->size - 1);
+    while (cache->names[index])
+        index = (index + 1) & (cache->size - 1);
+
+    cache->names[index] = strdup(procname);
+    if (!cache->names[index])
+        return proc;
+
+    cache->procs[index] = proc;
+    cache->count++;
+    return proc;
+}
+
+// Attaches the function pointer cache of the share group or of an identical
+// context to the current context, creating a new cache if there is none
+// Function pointers may depend on the pixel format, so contexts whose pixel
+// format cannot be identified only share caches within their share group
+//
+static void attachProcCache(_GLFWwindow* window, _GLFWwindow* share)
+{
+    _GLFWproccache* cache;
+    const int format = _glfwPlatformGetPixelFormatID(window);
+    const char* vendor;
+    const char* renderer;
+    const char* version;
+    char* key;
+
+    if (share && share->context.procs)
+    {
+        window->context.procs = share->context.procs;
+        return;
+    }
+
+    vendor = (const char*) glGetString(GL_VENDOR);
+    renderer = (const char*) glGetString(GL_RENDERER);
+    version = (const char*) glGetString(GL_VERSION);
+
+    if (!vendor)
+        vendor = "";
+    if (!renderer)
+        renderer = "";
+    if (!version)
+        version = "";
+
+    key = malloc(strlen(vendor) + strlen(renderer) + strlen(version) + 48);
+    if (!key)
+        return;
+
+    sprintf(key, "%i %i %i\n%s\n%s\n%s",
+            window->context.api, window->context.profile, format,
+            vendor, renderer, version);
+
+    for (cache = _glfw.procCacheListHead;  cache && format;  cache = cache->next)
+    {
+        if (strcmp(cache->key, key) == 0)
+        {
+            free(key);
+            window->context.procs = cache;
+            return;
+        }
+    }
+
+    cache = calloc(1, sizeof(_GLFWproccache));
+    if (!cache)
+    {
+        free(key);
+        return;
+    }
+
+    cache->key = key;
+    cache->next = _glfw.procCacheListHead;
+    _glfw.procCacheListHead = cache;
+
+    window->context.procs = cache;
+}
+
+// Checks whether the current context or the context API supports the
+// specified extension
+//
+static int extensionSupported(_GLFWwindow* window, const char* extension)
+{
+    if (!extension || *extension == '\0')
+    {
+        _glfwInputError(GLFW_INVALID_VALUE, NULL);
+        return GL_FALSE;
+    }
+
+    if (_glfwExtensionInSet(&window->context.extensions, extension))
+        return GL_TRUE;
+
+    // Check if extension is in the platform-specific string
+    return _glfwPlatformExtensionSupported(extension);
+}
 
 // Parses the client API version string and extracts the version number
 //
@@ -83,6 +380,50 @@ static GLboolean parseGLVersion(int* api, int* major, int* minor, int* rev)
 }
 
 
+// Returns the refresh rate used to estimate the MSC of the specified window
+//
+static int getEstimatedRefreshRate(_GLFWwindow* window)
+{
+    GLFWvidmode mode;
+    _GLFWmonitor* monitor = window->monitor;
+
+    if (!monitor)
+    {
+        if (!_glfw.monitorCount)
+            return 60;
+
+        monitor = _glfw.monitors[0];
+    }
+
+    _glfwPlatformGetVideoMode(monitor, &mode);
+    if (mode.refreshRate <= 0)
+        return 60;
+
+    return mode.refreshRate;
+}
+
+// Applies the specified swap interval to the framebuffer of the specified
+// window without changing the interval set with glfwSwapInterval
+// The context is made current only if the interval needs to change and the
+// platform requires it, and whether it was is returned
+//
+static GLboolean applySwapInterval(_GLFWwindow* window, int interval)
+{
+    GLboolean switched = GL_FALSE;
+
+    if (window->appliedInterval == interval)
+        return GL_FALSE;
+
+    if (_glfwPlatformSwapIntervalNeedsContext(window))
+    {
+        glfwMakeContextCurrent((GLFWwindow*) window);
+        switched = GL_TRUE;
+    }
+
+    window->appliedInterval = _glfwPlatformSwapInterval(window, interval);
+    return switched;
+}
+
 //////////////////////////////////////////////////////////////////////////
 //////                       GLFW internal API                      //////
 //////////////////////////////////////////////////////////////////////////
@@ -198,6 +539,34 @@ GLboolean _glfwIsValidContextConfig(const _GLFWctxconfig* ctxconfig)
         }
     }
 
+    if (ctxconfig->release)
+    {
+        if (ctxconfig->release != GLFW_RELEASE_BEHAVIOR_NONE &&
+            ctxconfig->release != GLFW_RELEASE_BEHAVIOR_FLUSH)
+        {
+            _glfwInputError(GLFW_INVALID_VALUE,
+                            "Invalid context release behavior requested");
+            return GL_FALSE;
+        }
+    }
+
+    if (ctxconfig->noerror && ctxconfig->debug)
+    {
+        // A no error context cannot report the errors a debug context exists
+        // to report
+        _glfwInputError(GLFW_INVALID_VALUE,
+                        "No error contexts cannot be debug contexts");
+        return GL_FALSE;
+    }
+
+    if (ctxconfig->noerror && ctxconfig->robustness)
+    {
+        // A no error context has no defined behavior to be robust about
+        _glfwInputError(GLFW_INVALID_VALUE,
+                        "No error contexts cannot be robust contexts");
+        return GL_FALSE;
+    }
+
     return GL_TRUE;
 }
 
@@ -385,7 +754,12 @@ GLboolean _glfwRefreshContextAttribs(const _GLFWctxconfig* ctxconfig)
             return GL_FALSE;
         }
     }
+#endif // _GLFW_USE_OPENGL
 
+    // The extension set is built before any of the queries below need it
+    refreshExtensions(window);
+
+#if defined(_GLFW_USE_OPENGL)
     if (window->context.api == GLFW_OPENGL_API)
     {
         // Read back context flags (OpenGL 3.0 and above)
@@ -407,6 +781,9 @@ GLboolean _glfwRefreshContextAttribs(const _GLFWctxconfig* ctxconfig)
                 //       debug contexts
                 window->context.debug = GL_TRUE;
             }
+
+            if (flags & GL_CONTEXT_FLAG_NO_ERROR_BIT_KHR)
+                window->context.noerror = GL_TRUE;
         }
 
         // Read back OpenGL context profile (OpenGL 3.2 and above)
@@ -462,8 +839,22 @@ GLboolean _glfwRefreshContextAttribs(const _GLFWctxconfig* ctxconfig)
                 window->context.robustness = GLFW_NO_RESET_NOTIFICATION;
         }
     }
+
+    // Read back release behavior
+    if (glfwExtensionSupported("GL_KHR_context_flush_control"))
+    {
+        GLint behavior;
+        glGetIntegerv(GL_CONTEXT_RELEASE_BEHAVIOR, &behavior);
+
+        if (behavior == GL_NONE)
+            window->context.release = GLFW_RELEASE_BEHAVIOR_NONE;
+        else if (behavior == GL_CONTEXT_RELEASE_BEHAVIOR_FLUSH)
+            window->context.release = GLFW_RELEASE_BEHAVIOR_FLUSH;
+    }
 #endif // _GLFW_USE_OPENGL
 
+    attachProcCache(window, ctxconfig->share);
+
     return GL_TRUE;
 }
 
@@ -518,6 +909,115 @@ int _glfwStringInExtensionString(const char* string, const GLubyte* extensions)
     return GL_TRUE;
 }
 
+GLboolean _glfwInitExtensionSet(_GLFWextensions* set, const char* string)
+{
+    unsigned int count = 0;
+    char* name;
+    char* end;
+
+    memset(set, 0, sizeof(_GLFWextensions));
+
+    set->names = strdup(string);
+    if (!set->names)
+        return GL_FALSE;
+
+    // Count the names so the table can be kept at most half full
+
+    for (name = set->names;  *name;  )
+    {
+        if (*name == ' ')
+            name++;
+        else
+        {
+            count++;
+            while (*name && *name != ' ')
+                name++;
+        }
+    }
+
+    set->size = 16;
+    while (set->size < count * 2)
+        set->size *= 2;
+
+    set->buckets = calloc(set->size, sizeof(char*));
+    if (!set->buckets)
+    {
+        _glfwFreeExtensionSet(set);
+        return GL_FALSE;
+    }
+
+    // Split the copy in place and insert each name
+
+    name = set->names;
+    for (;;)
+    {
+        while (*name == ' ')
+            name++;
+
+        if (*name == '\0')
+            break;
+
+        end = name;
+        while (*end && *end != ' ')
+            end++;
+
+        if (*end)
+            *end++ = '\0';
+
+        insertExtension(set, name);
+        name = end;
+    }
+
+    return GL_TRUE;
+}
+
+void _glfwFreeExtensionSet(_GLFWextensions* set)
+{
+    free(set->buckets);
+    free(set->names);
+    memset(set, 0, sizeof(_GLFWextensions));
+}
+
+void _glfwFreeProcCaches(void)
+{
+    unsigned int i;
+
+    while (_glfw.procCacheListHead)
+    {
+        _GLFWproccache* cache = _glfw.procCacheListHead;
+        _glfw.procCacheListHead = cache->next;
+
+        for (i = 0;  i < cache->size;  i++)
+            free(cache->names[i]);
+
+        free(cache->names);
+        free(cache->procs);
+        free(cache->key);
+        free(cache);
+    }
+}
+
+GLboolean _glfwExtensionInSet(const _GLFWextensions* set, const char* extension)
+{
+    unsigned int mask, index;
+
+    if (!set->size)
+        return GL_FALSE;
+
+    mask = set->size - 1;
+    index = hashString(extension) & mask;
+
+    while (set->buckets[index])
+    {
+        if (strcmp(set->buckets[index], extension) == 0)
+            return GL_TRUE;
+
+        index = (index + 1) & mask;
+    }
+
+    return GL_FALSE;
+}
+
 
 //////////////////////////////////////////////////////////////////////////
 //////                        GLFW public API                       //////
@@ -525,14 +1025,40 @@ int _glfwStringInExtensionString(const char* string, const GLubyte* extensions)
 
 GLFWAPI void glfwMakeContextCurrent(GLFWwindow* handle)
 {
-    _GLFWwindow* window = (_GLFWwindow*) handle;
+    glfwMakeContextCurrentOn(handle, handle);
+}
+
+GLFWAPI void glfwMakeContextCurrentOn(GLFWwindow* contextHandle,
+                                      GLFWwindow* targetHandle)
+{
+    _GLFWwindow* window = (_GLFWwindow*) contextHandle;
+    _GLFWwindow* target = (_GLFWwindow*) targetHandle;
 
     _GLFW_REQUIRE_INIT();
 
-    if (_glfwPlatformGetCurrentContext() == window)
+    if (!window)
+    {
+        if (_glfwPlatformGetCurrentContext())
+            _glfwPlatformMakeContextCurrent(NULL);
+
         return;
+    }
+
+    if (!target)
+        target = window;
 
-    _glfwPlatformMakeContextCurrent(window);
+    if (_glfwPlatformGetCurrentContext() == window &&
+        window->context.target == target)
+    {
+        return;
+    }
+
+    if (target == window)
+        _glfwPlatformMakeContextCurrent(window);
+    else if (!_glfwPlatformMakeContextCurrentOn(window, target))
+        return;
+
+    window->context.target = target;
 }
 
 GLFWAPI GLFWwindow* glfwGetCurrentContext(void)
@@ -544,26 +1070,169 @@ GLFWAPI GLFWwindow* glfwGetCurrentContext(void)
 GLFWAPI void glfwSwapBuffers(GLFWwindow* handle)
 {
     _GLFWwindow* window = (_GLFWwindow*) handle;
+
     _GLFW_REQUIRE_INIT();
+
+    // Offscreen contexts have no buffers to swap
+    if (window->offscreen)
+        return;
+
+    // Restore the interval set with glfwSwapInterval if a batched swap
+    // changed it
+    if (window->appliedInterval != window->swapInterval)
+    {
+        _GLFWwindow* previous = _glfwPlatformGetCurrentContext();
+        _GLFWwindow* previousTarget = NULL;
+
+        if (previous)
+            previousTarget = previous->context.target;
+
+        if (applySwapInterval(window, window->swapInterval))
+        {
+            glfwMakeContextCurrentOn((GLFWwindow*) previous,
+                                     (GLFWwindow*) previousTarget);
+        }
+    }
+
     _glfwPlatformSwapBuffers(window);
+    window->context.swapCount++;
+}
+
+GLFWAPI void glfwSwapBuffersMulti(GLFWwindow** handles, int count)
+{
+    int i, interval = 0, carrier = -1;
+    GLboolean switched = GL_FALSE;
+    _GLFWwindow* previous;
+    _GLFWwindow* previousTarget = NULL;
+
+    _GLFW_REQUIRE_INIT();
+
+    // The first window carries the strongest synchronization requested by
+    // any of the windows, while the others swap without waiting
+    for (i = 0;  i < count;  i++)
+    {
+        _GLFWwindow* window = (_GLFWwindow*) handles[i];
+
+        // Offscreen contexts have no buffers to swap
+        if (window->offscreen)
+            continue;
+
+        if (carrier == -1)
+            carrier = i;
+
+        if (abs(window->swapInterval) > abs(interval))
+            interval = window->swapInterval;
+    }
+
+    previous = _glfwPlatformGetCurrentContext();
+    if (previous)
+        previousTarget = previous->context.target;
+
+    for (i = 0;  i < count;  i++)
+    {
+        _GLFWwindow* window = (_GLFWwindow*) handles[i];
+        const int desired = (i == carrier) ? interval : 0;
+
+        if (window->offscreen)
+            continue;
+
+        if (applySwapInterval(window, desired))
+            switched = GL_TRUE;
+
+        _glfwPlatformSwapBuffers(window);
+        window->context.swapCount++;
+    }
+
+    if (switched)
+    {
+        glfwMakeContextCurrentOn((GLFWwindow*) previous,
+                                 (GLFWwindow*) previousTarget);
+    }
 }
 
 GLFWAPI void glfwSwapInterval(int interval)
 {
+    _GLFWwindow* window;
+
     _GLFW_REQUIRE_INIT();
 
-    if (!_glfwPlatformGetCurrentContext())
+    window = _glfwPlatformGetCurrentContext();
+    if (!window)
     {
         _glfwInputError(GLFW_NO_CURRENT_CONTEXT, NULL);
         return;
     }
 
-    _glfwPlatformSwapInterval(interval);
+    // The interval applies to the framebuffer the context renders to
+    if (window->context.target)
+        window = window->context.target;
+
+    if (window->offscreen)
+        return;
+
+    window->swapInterval = window->appliedInterval =
+        _glfwPlatformSwapInterval(window, interval);
+}
+
+GLFWAPI int glfwGetFrameTiming(GLFWwindow* handle,
+                               int64_t* ust, int64_t* msc, int64_t* sbc)
+{
+    _GLFWwindow* window = (_GLFWwindow*) handle;
+    int64_t values[3] = { 0, 0, 0 };
+    int result = GL_FALSE;
+
+    if (ust)
+        *ust = 0;
+    if (msc)
+        *msc = 0;
+    if (sbc)
+        *sbc = 0;
+
+    _GLFW_REQUIRE_INIT_OR_RETURN(GL_FALSE);
+
+    if (!window->offscreen)
+        result = _glfwPlatformGetSyncValues(window, values, values + 1, values + 2);
+
+    if (!result)
+    {
+        const double time = _glfwPlatformGetTime();
+
+        values[0] = (int64_t) (time * 1e6);
+        values[1] = (int64_t) (time * getEstimatedRefreshRate(window));
+        values[2] = window->context.swapCount;
+    }
+
+    if (ust)
+        *ust = values[0];
+    if (msc)
+        *msc = values[1];
+    if (sbc)
+        *sbc = values[2];
+
+    return result;
+}
+
+GLFWAPI int glfwWaitForMSC(GLFWwindow* handle, int64_t msc)
+{
+    _GLFWwindow* window = (_GLFWwindow*) handle;
+    double remaining;
+
+    _GLFW_REQUIRE_INIT_OR_RETURN(GL_FALSE);
+
+    if (!window->offscreen && _glfwPlatformWaitForMSC(window, msc))
+        return GL_TRUE;
+
+    // Sleep until the time the estimated MSC reaches the target
+    remaining = (double) msc / getEstimatedRefreshRate(window) -
+                _glfwPlatformGetTime();
+    if (remaining > 0.0)
+        _glfwPlatformSleep(remaining);
+
+    return GL_FALSE;
 }
 
 GLFWAPI int glfwExtensionSupported(const char* extension)
 {
-    const GLubyte* extensions;
     _GLFWwindow* window;
 
     _GLFW_REQUIRE_INIT_OR_RETURN(GL_FALSE);
@@ -575,67 +1244,126 @@ GLFWAPI int glfwExtensionSupported(const char* extension)
         return GL_FALSE;
     }
 
-    if (!extension || *extension == '\0')
+    return extensionSupported(window, extension);
+}
+
+GLFWAPI void glfwExtensionsSupported(const char** extensions,
+                                     int* results,
+                                     int count)
+{
+    int i;
+    _GLFWwindow* window;
+
+    for (i = 0;  i < count;  i++)
+        results[i] = GL_FALSE;
+
+    _GLFW_REQUIRE_INIT();
+
+    window = _glfwPlatformGetCurrentContext();
+    if (!window)
     {
-        _glfwInputError(GLFW_INVALID_VALUE, NULL);
-        return GL_FALSE;
+        _glfwInputError(GLFW_NO_CURRENT_CONTEXT, NULL);
+        return;
     }
 
-    if (window->context.major < 3)
-    {
-        // Check if extension is in the old style OpenGL extensions string
+    for (i = 0;  i < count;  i++)
+        results[i] = extensionSupported(window, extensions[i]);
+}
 
-        extensions = glGetString(GL_EXTENSIONS);
-        if (!extensions)
-        {
-            _glfwInputError(GLFW_PLATFORM_ERROR,
-                            "Failed to retrieve extension string");
-            return GL_FALSE;
-        }
+GLFWAPI const GLFWfbconfig* glfwGetFramebufferConfigs(int* count)
+{
+    int i, nativeCount;
+    const _GLFWfbconfig* configs;
 
-        if (_glfwStringInExtensionString(extension, extensions))
-            return GL_TRUE;
-    }
-#if defined(_GLFW_USE_OPENGL)
-    else
-    {
-        int i;
-        GLint count;
+    *count = 0;
 
-        // Check if extension is in the modern OpenGL extensions string list
+    _GLFW_REQUIRE_INIT_OR_RETURN(NULL);
 
-        glGetIntegerv(GL_NUM_EXTENSIONS, &count);
+    if (!_glfw.fbconfigs)
+    {
+        configs = _glfwPlatformGetFramebufferConfigs(&nativeCount);
+        if (!configs || !nativeCount)
+            return NULL;
 
-        for (i = 0;  i < count;  i++)
-        {
-            const char* en = (const char*) window->GetStringi(GL_EXTENSIONS, i);
-            if (!en)
-            {
-                _glfwInputError(GLFW_PLATFORM_ERROR,
-                                "Failed to retrieve extension string %i", i);
-                return GL_FALSE;
-            }
+        _glfw.fbconfigs = calloc(nativeCount, sizeof(GLFWfbconfig));
 
-            if (strcmp(en, extension) == 0)
-                return GL_TRUE;
+        for (i = 0;  i < nativeCount;  i++)
+        {
+            const _GLFWfbconfig* n = configs + i;
+            GLFWfbconfig* u = _glfw.fbconfigs + i;
+
+            u->redBits = n->redBits;
+            u->greenBits = n->greenBits;
+            u->blueBits = n->blueBits;
+            u->alphaBits = n->alphaBits;
+            u->depthBits = n->depthBits;
+            u->stencilBits = n->stencilBits;
+            u->accumRedBits = n->accumRedBits;
+            u->accumGreenBits = n->accumGreenBits;
+            u->accumBlueBits = n->accumBlueBits;
+            u->accumAlphaBits = n->accumAlphaBits;
+            u->auxBuffers = n->auxBuffers;
+            u->stereo = n->stereo;
+            u->samples = n->samples;
+            u->sRGB = n->sRGB;
         }
+
+        _glfw.fbconfigCount = nativeCount;
     }
-#endif // _GLFW_USE_OPENGL
 
-    // Check if extension is in the platform-specific string
-    return _glfwPlatformExtensionSupported(extension);
+    *count = _glfw.fbconfigCount;
+    return _glfw.fbconfigs;
 }
 
 GLFWAPI GLFWglproc glfwGetProcAddress(const char* procname)
 {
+    GLFWglproc proc;
+    _GLFWwindow* window;
+
     _GLFW_REQUIRE_INIT_OR_RETURN(NULL);
 
-    if (!_glfwPlatformGetCurrentContext())
+    window = _glfwPlatformGetCurrentContext();
+    if (!window)
     {
         _glfwInputError(GLFW_NO_CURRENT_CONTEXT, NULL);
         return NULL;
     }
 
-    return _glfwPlatformGetProcAddress(procname);
+    _glfwPlatformLockProcCache();
+    proc = getCachedProc(window->context.procs, procname);
+    _glfwPlatformUnlockProcCache();
+
+    return proc;
+}
+
+GLFWAPI int glfwLoadProcs(const char** procnames, GLFWglproc* procs, int count)
+{
+    int i, loaded = 0;
+    _GLFWwindow* window;
+
+    for (i = 0;  i < count;  i++)
+        procs[i] = NULL;
+
+    _GLFW_REQUIRE_INIT_OR_RETURN(0);
+
+    window = _glfwPlatformGetCurrentContext();
+    if (!window)
+    {
+        _glfwInputError(GLFW_NO_CURRENT_CONTEXT, NULL);
+        return 0;
+    }
+
+    _glfwPlatformLockProcCache();
+
+    for (i = 0;  i < count;  i++)
+    {
+        procs[i] = getCachedProc(window->context.procs, procnames[i]);
+        if (procs[i])
+            loaded++;
+    }
+
+    _glfwPlatformUnlockProcCache();
+
+    return loaded;
 }
 
@@ -31,6 +31,16 @@
 #include <stdlib.h>
 #include <assert.h>
 
+#ifndef EGL_CONTEXT_OPENGL_NO_ERROR_KHR
+ #define EGL_CONTEXT_OPENGL_NO_ERROR_KHR 0x31b3
+#endif
+
+#ifndef EGL_KHR_context_flush_control
+ #define EGL_CONTEXT_RELEASE_BEHAVIOR_KHR 0x2097
+ #define EGL_CONTEXT_RELEASE_BEHAVIOR_NONE_KHR 0
+ #define EGL_CONTEXT_RELEASE_BEHAVIOR_FLUSH_KHR 0x2098
+#endif
+
 
 // Thread local storage attribute macro
 //
@@ -47,6 +57,10 @@
 //
 static _GLFW_TLS _GLFWwindow* _glfwCurrentWindow = NULL;
 
+// The lock for the context function pointer caches
+//
+static pthread_mutex_t _glfwProcCacheLock = PTHREAD_MUTEX_INITIALIZER;
+
 
 // Return a description of the specified EGL error
 //
@@ -106,28 +120,36 @@ static int getConfigAttrib(EGLConfig config, int attrib)
     return value;
 }
 
-// Return a list of available and usable framebuffer configs
+// Returns the usable framebuffer configs of the display, translating them on
+// first use
 //
-static GLboolean chooseFBConfigs(const _GLFWwndconfig* wndconfig,
-                                 const _GLFWfbconfig* desired,
-                                 EGLConfig* result)
+static const _GLFWfbconfig* getFBConfigs(int* count)
 {
     EGLConfig* nativeConfigs;
     _GLFWfbconfig* usableConfigs;
-    const _GLFWfbconfig* closest;
+    EGLint* renderableTypes;
     int i, nativeCount, usableCount;
 
+    if (_glfw.egl.fbconfigs)
+    {
+        *count = _glfw.egl.fbconfigCount;
+        return _glfw.egl.fbconfigs;
+    }
+
+    *count = 0;
+
     eglGetConfigs(_glfw.egl.display, NULL, 0, &nativeCount);
     if (!nativeCount)
     {
         _glfwInputError(GLFW_API_UNAVAILABLE, "EGL: No EGLConfigs returned");
-        return GL_FALSE;
+        return NULL;
     }
 
     nativeConfigs = calloc(nativeCount, sizeof(EGLConfig));
     eglGetConfigs(_glfw.egl.display, nativeConfigs, nativeCount, &nativeCount);
 
     usableConfigs = calloc(nativeCount, sizeof(_GLFWfbconfig));
+    renderableTypes = calloc(nativeCount, sizeof(EGLint));
     usableCount = 0;
 
     for (i = 0;  i < nativeCount;  i++)
@@ -155,24 +177,8 @@ static GLboolean chooseFBConfigs(const _GLFWwndconfig* wndconfig,
             continue;
         }
 
-        if (wndconfig->clientAPI == GLFW_OPENGL_ES_API)
-        {
-            if (wndconfig->glMajor == 1)
-            {
-                if (!(getConfigAttrib(n, EGL_RENDERABLE_TYPE) & EGL_OPENGL_ES_BIT))
-                    continue;
-            }
-            else
-            {
-                if (!(getConfigAttrib(n, EGL_RENDERABLE_TYPE) & EGL_OPENGL_ES2_BIT))
-                    continue;
-            }
-        }
-        else if (wndconfig->clientAPI == GLFW_OPENGL_API)
-        {
-            if (!(getConfigAttrib(n, EGL_RENDERABLE_TYPE) & EGL_OPENGL_BIT))
-                continue;
-        }
+        // The client API is filtered on when choosing, as it varies per window
+        renderableTypes[usableCount] = getConfigAttrib(n, EGL_RENDERABLE_TYPE);
 
         u->redBits = getConfigAttrib(n, EGL_RED_SIZE);
         u->greenBits = getConfigAttrib(n, EGL_GREEN_SIZE);
@@ -188,17 +194,83 @@ static GLboolean chooseFBConfigs(const _GLFWwndconfig* wndconfig,
         usableCount++;
     }
 
+    free(nativeConfigs);
+
+    _glfw.egl.fbconfigs = usableConfigs;
+    _glfw.egl.renderableTypes = renderableTypes;
+    _glfw.egl.fbconfigCount = usableCount;
+
+    *count = usableCount;
+    return usableConfigs;
+}
+
+// Chooses the usable framebuffer config closest to the desired one that
+// supports the requested client API
+//
+static GLboolean chooseFBConfigs(const _GLFWwndconfig* wndconfig,
+                                 const _GLFWfbconfig* desired,
+                                 EGLConfig* result)
+{
+    const _GLFWfbconfig* configs;
+    _GLFWfbconfig* usableConfigs;
+    const _GLFWfbconfig* closest;
+    int i, count, usableCount = 0;
+    EGLint required;
+
+    configs = getFBConfigs(&count);
+    if (!configs)
+        return GL_FALSE;
+
+    if (wndconfig->clientAPI == GLFW_OPENGL_ES_API)
+    {
+        if (wndconfig->glMajor == 1)
+            required = EGL_OPENGL_ES_BIT;
+        else
+            required = EGL_OPENGL_ES2_BIT;
+    }
+    else
+        required = EGL_OPENGL_BIT;
+
+    usableConfigs = calloc(count, sizeof(_GLFWfbconfig));
+
+    for (i = 0;  i < count;  i++)
+    {
+        if (_glfw.egl.renderableTypes[i] & required)
+            usableConfigs[usableCount++] = configs[i];
+    }
+
     closest = _glfwChooseFBConfig(desired, usableConfigs, usableCount);
     if (closest)
         *result = closest->egl;
 
-    free(nativeConfigs);
     free(usableConfigs);
 
     return closest ? GL_TRUE : GL_FALSE;
 }
 
 
+// Creates the window surface of the specified window, if necessary
+//
+static GLboolean createSurface(_GLFWwindow* window)
+{
+    if (window->egl.surface != EGL_NO_SURFACE)
+        return GL_TRUE;
+
+    window->egl.surface = eglCreateWindowSurface(_glfw.egl.display,
+                                                 window->egl.config,
+                                                 (EGLNativeWindowType)_GLFW_EGL_NATIVE_WINDOW,
+                                                 NULL);
+    if (window->egl.surface == EGL_NO_SURFACE)
+    {
+        _glfwInputError(GLFW_PLATFORM_ERROR,
+                        "EGL: Failed to create window surface: %s",
+                        getErrorString(eglGetError()));
+        return GL_FALSE;
+    }
+
+    return GL_TRUE;
+}
+
 //////////////////////////////////////////////////////////////////////////
 //////                       GLFW internal API                      //////
 //////////////////////////////////////////////////////////////////////////
@@ -229,6 +301,12 @@ int _glfwInitContextAPI(void)
     if (_glfwPlatformExtensionSupported("EGL_KHR_create_context"))
         _glfw.egl.KHR_create_context = GL_TRUE;
 
+    if (_glfwPlatformExtensionSupported("EGL_KHR_context_flush_control"))
+        _glfw.egl.KHR_context_flush_control = GL_TRUE;
+
+    if (_glfwPlatformExtensionSupported("EGL_KHR_create_context_no_error"))
+        _glfw.egl.KHR_create_context_no_error = GL_TRUE;
+
     return GL_TRUE;
 }
 
@@ -236,6 +314,13 @@ int _glfwInitContextAPI(void)
 //
 void _glfwTerminateContextAPI(void)
 {
+    free(_glfw.egl.fbconfigs);
+    free(_glfw.egl.renderableTypes);
+
+    _glfw.egl.fbconfigs = NULL;
+    _glfw.egl.renderableTypes = NULL;
+    _glfw.egl.fbconfigCount = 0;
+
     eglTerminate(_glfw.egl.display);
 }
 
@@ -380,6 +465,23 @@ int _glfwCreateContext(_GLFWwindow* window,
         if (strategy)
             setEGLattrib(EGL_CONTEXT_OPENGL_RESET_NOTIFICATION_STRATEGY_KHR, strategy);
 
+        if (wndconfig->glNoError && _glfw.egl.KHR_create_context_no_error)
+            setEGLattrib(EGL_CONTEXT_OPENGL_NO_ERROR_KHR, GL_TRUE);
+
+        if (wndconfig->glRelease && _glfw.egl.KHR_context_flush_control)
+        {
+            if (wndconfig->glRelease == GLFW_RELEASE_BEHAVIOR_NONE)
+            {
+                setEGLattrib(EGL_CONTEXT_RELEASE_BEHAVIOR_KHR,
+                             EGL_CONTEXT_RELEASE_BEHAVIOR_NONE_KHR);
+            }
+            else if (wndconfig->glRelease == GLFW_RELEASE_BEHAVIOR_FLUSH)
+            {
+                setEGLattrib(EGL_CONTEXT_RELEASE_BEHAVIOR_KHR,
+                             EGL_CONTEXT_RELEASE_BEHAVIOR_FLUSH_KHR);
+            }
+        }
+
         setEGLattrib(EGL_NONE, EGL_NONE);
     }
     else
@@ -453,23 +555,23 @@ int _glfwAnalyzeContext(const _GLFWwindow* window,
 //////                       GLFW platform API                      //////
 //////////////////////////////////////////////////////////////////////////
 
+int _glfwPlatformCreateOffscreenContext(_GLFWwindow* window,
+                                        const _GLFWctxconfig* ctxconfig,
+                                        const _GLFWfbconfig* fbconfig)
+{
+    // Offscreen contexts could be made current without a surface with
+    // EGL_KHR_surfaceless_context, but the EGL back-end was left out of their
+    // scope, as it does not currently build
+    _glfwInputError(GLFW_API_UNAVAILABLE,
+                    "EGL: Offscreen contexts are not yet supported");
+    return GL_FALSE;
+}
+
 void _glfwPlatformMakeContextCurrent(_GLFWwindow* window)
 {
     if (window)
     {
-        if (window->egl.surface == EGL_NO_SURFACE)
-        {
-            window->egl.surface = eglCreateWindowSurface(_glfw.egl.display,
-                                                         window->egl.config,
-                                                         (EGLNativeWindowType)_GLFW_EGL_NATIVE_WINDOW,
-                                                         NULL);
-            if (window->egl.surface == EGL_NO_SURFACE)
-            {
-                _glfwInputError(GLFW_PLATFORM_ERROR,
-                                "EGL: Failed to create window surface: %s",
-                                getErrorString(eglGetError()));
-            }
-        }
+        createSurface(window);
 
         eglMakeCurrent(_glfw.egl.display,
                        window->egl.surface,
@@ -485,6 +587,27 @@ void _glfwPlatformMakeContextCurrent(_GLFWwindow* window)
     _glfwCurrentWindow = window;
 }
 
+int _glfwPlatformMakeContextCurrentOn(_GLFWwindow* window, _GLFWwindow* target)
+{
+    if (window->egl.config != target->egl.config)
+    {
+        _glfwInputError(GLFW_INVALID_VALUE,
+                        "EGL: The framebuffer of the target window is not compatible with the context");
+        return GL_FALSE;
+    }
+
+    if (!createSurface(target))
+        return GL_FALSE;
+
+    eglMakeCurrent(_glfw.egl.display,
+                   target->egl.surface,
+                   target->egl.surface,
+                   window->egl.context);
+
+    _glfwCurrentWindow = window;
+    return GL_TRUE;
+}
+
 _GLFWwindow* _glfwPlatformGetCurrentContext(void)
 {
     return _glfwCurrentWindow;
@@ -495,9 +618,53 @@ void _glfwPlatformSwapBuffers(_GLFWwindow* window)
     eglSwapBuffers(_glfw.egl.display, window->egl.surface);
 }
 
-void _glfwPlatformSwapInterval(int interval)
+int _glfwPlatformSwapInterval(_GLFWwindow* window, int interval)
+{
+    int minimum, maximum;
+
+    // EGL has no swaps that tear when late, so fall back to regular vsync
+    if (interval < 0)
+        interval = -interval;
+
+    if (!eglSwapInterval(_glfw.egl.display, interval))
+        return window->appliedInterval;
+
+    // The interval is silently clamped to the range supported by the config
+    minimum = getConfigAttrib(window->egl.config, EGL_MIN_SWAP_INTERVAL);
+    maximum = getConfigAttrib(window->egl.config, EGL_MAX_SWAP_INTERVAL);
+
+    if (interval < minimum)
+        interval = minimum;
+    if (interval > maximum)
+        interval = maximum;
+
+    return interval;
+}
+
+int _glfwPlatformSwapIntervalNeedsContext(_GLFWwindow* window)
+{
+    // eglSwapInterval applies to the surface of the current context
+    return GL_TRUE;
+}
+
+int _glfwPlatformGetSwapInterval(_GLFWwindow* window)
+{
+    // The swap interval cannot be queried
+    return window->appliedInterval;
+}
+
+int _glfwPlatformGetSyncValues(_GLFWwindow* window,
+                               int64_t* ust, int64_t* msc, int64_t* sbc)
 {
-    eglSwapInterval(_glfw.egl.display, interval);
+    // EGL has no counterpart to GLX_OML_sync_control for reading the
+    // retrace and swap counters of a surface
+    return GL_FALSE;
+}
+
+int _glfwPlatformWaitForMSC(_GLFWwindow* window, int64_t msc)
+{
+    // EGL has no way of waiting for a given retrace count
+    return GL_FALSE;
 }
 
 int _glfwPlatformExtensionSupported(const char* extension)
@@ -514,11 +681,31 @@ int _glfwPlatformExtensionSupported(const char* extension)
     return GL_FALSE;
 }
 
+const _GLFWfbconfig* _glfwPlatformGetFramebufferConfigs(int* count)
+{
+    return getFBConfigs(count);
+}
+
 GLFWglproc _glfwPlatformGetProcAddress(const char* procname)
 {
     return eglGetProcAddress(procname);
 }
 
+void _glfwPlatformLockProcCache(void)
+{
+    pthread_mutex_lock(&_glfwProcCacheLock);
+}
+
+void _glfwPlatformUnlockProcCache(void)
+{
+    pthread_mutex_unlock(&_glfwProcCacheLock);
+}
+
+int _glfwPlatformGetPixelFormatID(_GLFWwindow* window)
+{
+    return getConfigAttrib(window->egl.config, EGL_CONFIG_ID);
+}
+
 
 //////////////////////////////////////////////////////////////////////////
 //////                        GLFW native API                       //////
@@ -35,6 +35,8 @@
 // extensions and not all operating systems come with an up-to-date version
 #include "../deps/EGL/eglext.h"
 
+#include <pthread.h>
+
 // Do we have support for dlopen/dlsym?
 #if defined(_GLFW_HAS_DLOPEN)
  #include <dlfcn.h>
@@ -73,6 +75,13 @@ typedef struct _GLFWlibraryEGL
     EGLint          versionMajor, versionMinor;
 
     GLboolean       KHR_create_context;
+    GLboolean       KHR_create_context_no_error;
+    GLboolean       KHR_context_flush_control;
+
+    // Usable EGLConfigs of the display, translated on first use
+    _GLFWfbconfig*  fbconfigs;
+    EGLint*         renderableTypes;
+    int             fbconfigCount;
 
 } _GLFWlibraryEGL;
 
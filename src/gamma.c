@@ -37,6 +37,12 @@
 
 void _glfwAllocGammaArrays(GLFWgammaramp* ramp, unsigned int size)
 {
+    // Reuse the existing arrays if they are already the right size
+    if (ramp->size == size && ramp->red)
+        return;
+
+    _glfwFreeGammaArrays(ramp);
+
     ramp->red = calloc(size, sizeof(unsigned short));
     ramp->green = calloc(size, sizeof(unsigned short));
     ramp->blue = calloc(size, sizeof(unsigned short));
@@ -59,8 +65,10 @@ void _glfwFreeGammaArrays(GLFWgammaramp* ramp)
 
 GLFWAPI void glfwSetGamma(GLFWmonitor* handle, float gamma)
 {
-    int i;
-    unsigned short values[256];
+    _GLFWmonitor* monitor = (_GLFWmonitor*) handle;
+    unsigned int i, size;
+    unsigned short* values;
+    double exponent, scale;
     GLFWgammaramp ramp;
 
     _GLFW_REQUIRE_INIT();
@@ -72,14 +80,29 @@ GLFWAPI void glfwSetGamma(GLFWmonitor* handle, float gamma)
         return;
     }
 
-    for (i = 0;  i < 256;  i++)
+    // Generate the ramp at the size used by the hardware, so that it does
+    // not need to be resampled
+    size = _glfwPlatformGetGammaRampSize(monitor);
+    if (size < 2)
+        size = 256;
+
+    // Skip generating the curve if it is already set
+    if (monitor->currentRampValid &&
+        monitor->gamma == gamma &&
+        monitor->gammaSize == size)
     {
-        double value;
+        return;
+    }
+
+    values = calloc(size, sizeof(unsigned short));
 
-        // Calculate intensity
-        value = i / 255.0;
-        // Apply gamma curve
-        value = pow(value, 1.0 / gamma) * 65535.0 + 0.5;
+    exponent = 1.0 / gamma;
+    scale = 1.0 / (size - 1);
+
+    for (i = 0;  i < size;  i++)
+    {
+        // Calculate intensity and apply gamma curve
+        double value = pow(i * scale, exponent) * 65535.0 + 0.5;
 
         // Clamp to value range
         if (value > 65535.0)
@@ -91,9 +114,14 @@ GLFWAPI void glfwSetGamma(GLFWmonitor* handle, float gamma)
     ramp.red = values;
     ramp.green = values;
     ramp.blue = values;
-    ramp.size = 256;
+    ramp.size = size;
 
     glfwSetGammaRamp(handle, &ramp);
+
+    free(values);
+
+    monitor->gamma = gamma;
+    monitor->gammaSize = size;
 }
 
 GLFWAPI const GLFWgammaramp* glfwGetGammaRamp(GLFWmonitor* handle)
@@ -102,8 +130,11 @@ GLFWAPI const GLFWgammaramp* glfwGetGammaRamp(GLFWmonitor* handle)
 
     _GLFW_REQUIRE_INIT_OR_RETURN(NULL);
 
-    _glfwFreeGammaArrays(&monitor->currentRamp);
-    _glfwPlatformGetGammaRamp(monitor, &monitor->currentRamp);
+    if (!monitor->currentRampValid)
+    {
+        _glfwPlatformGetGammaRamp(monitor, &monitor->currentRamp);
+        monitor->currentRampValid = GL_TRUE;
+    }
 
     return &monitor->currentRamp;
 }
@@ -111,12 +142,34 @@ GLFWAPI const GLFWgammaramp* glfwGetGammaRamp(GLFWmonitor* handle)
 GLFWAPI void glfwSetGammaRamp(GLFWmonitor* handle, const GLFWgammaramp* ramp)
 {
     _GLFWmonitor* monitor = (_GLFWmonitor*) handle;
+    GLFWgammaramp* current = &monitor->currentRamp;
+    const size_t bytes = ramp->size * sizeof(unsigned short);
 
     _GLFW_REQUIRE_INIT();
 
+    // The ramp is no longer known to have been generated by glfwSetGamma
+    monitor->gamma = 0.f;
+    monitor->gammaSize = 0;
+
+    // Skip the round trip if this ramp is already set
+    if (monitor->currentRampValid &&
+        current->size == ramp->size &&
+        memcmp(current->red, ramp->red, bytes) == 0 &&
+        memcmp(current->green, ramp->green, bytes) == 0 &&
+        memcmp(current->blue, ramp->blue, bytes) == 0)
+    {
+        return;
+    }
+
     if (!monitor->originalRamp.size)
         _glfwPlatformGetGammaRamp(monitor, &monitor->originalRamp);
 
     _glfwPlatformSetGammaRamp(monitor, ramp);
+
+    _glfwAllocGammaArrays(current, ramp->size);
+    memcpy(current->red, ramp->red, bytes);
+    memcpy(current->green, ramp->green, bytes);
+    memcpy(current->blue, ramp->blue, bytes);
+    monitor->currentRampValid = GL_TRUE;
 }
 
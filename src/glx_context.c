@@ -32,14 +32,27 @@
 #include <assert.h>
 
 
-// This is the only glXGetProcAddress variant not declared by glxext.h
-void (*glXGetProcAddressEXT(const GLubyte* procName))();
-
-
 #ifndef GLXBadProfileARB
  #define GLXBadProfileARB 13
 #endif
 
+#ifndef GLX_CONTEXT_OPENGL_NO_ERROR_ARB
+ #define GLX_CONTEXT_OPENGL_NO_ERROR_ARB 0x31b3
+#endif
+
+#ifndef GLX_ARB_context_flush_control
+ #define GLX_CONTEXT_RELEASE_BEHAVIOR_ARB 0x2097
+ #define GLX_CONTEXT_RELEASE_BEHAVIOR_NONE_ARB 0
+ #define GLX_CONTEXT_RELEASE_BEHAVIOR_FLUSH_ARB 0x2098
+#endif
+
+
+#if defined(_GLFW_TLS)
+// The per-thread current context/window pointer
+//
+static _GLFW_TLS _GLFWwindow* _glfwCurrentWindow = NULL;
+#endif
+
 
 // Returns the specified attribute of the specified GLXFBConfig
 //
@@ -50,17 +63,25 @@ static int getFBConfigAttrib(GLXFBConfig fbconfig, int attrib)
     return value;
 }
 
-// Return a list of available and usable framebuffer configs
+// Returns the usable framebuffer configs of the screen, translating them on
+// first use
 //
-static GLboolean chooseFBConfig(const _GLFWfbconfig* desired, GLXFBConfig* result)
+static const _GLFWfbconfig* getFBConfigs(int* count)
 {
     GLXFBConfig* nativeConfigs;
     _GLFWfbconfig* usableConfigs;
-    const _GLFWfbconfig* closest;
     int i, nativeCount, usableCount;
     const char* vendor;
     GLboolean trustWindowBit = GL_TRUE;
 
+    if (_glfw.glx.fbconfigs)
+    {
+        *count = _glfw.glx.fbconfigCount;
+        return _glfw.glx.fbconfigs;
+    }
+
+    *count = 0;
+
     vendor = glXGetClientString(_glfw.x11.display, GLX_VENDOR);
     if (strcmp(vendor, "Chromium") == 0)
     {
@@ -74,7 +95,7 @@ static GLboolean chooseFBConfig(const _GLFWfbconfig* desired, GLXFBConfig* resul
     if (!nativeCount)
     {
         _glfwInputError(GLFW_API_UNAVAILABLE, "GLX: No GLXFBConfigs returned");
-        return GL_FALSE;
+        return NULL;
     }
 
     usableConfigs = calloc(nativeCount, sizeof(_GLFWfbconfig));
@@ -133,16 +154,126 @@ static GLboolean chooseFBConfig(const _GLFWfbconfig* desired, GLXFBConfig* resul
         usableCount++;
     }
 
+    // The GLXFBConfig handles are owned by the display, but the array holding
+    // them is kept until termination to be safe
+    _glfw.glx.nativeConfigs = nativeConfigs;
+    _glfw.glx.fbconfigs = usableConfigs;
+    _glfw.glx.fbconfigCount = usableCount;
+
+    *count = usableCount;
+    return usableConfigs;
+}
+
+// Chooses the usable framebuffer config closest to the desired one
+//
+static GLboolean chooseFBConfig(const _GLFWfbconfig* desired, GLXFBConfig* result)
+{
+    const _GLFWfbconfig* configs;
+    const _GLFWfbconfig* closest;
+    int count;
+
+    configs = getFBConfigs(&count);
+    if (!configs)
+        return GL_FALSE;
+
+    closest = _glfwChooseFBConfig(desired, configs, count);
+    if (!closest)
+        return GL_FALSE;
+
+    *result = closest->glx;
+    return GL_TRUE;
+}
+
+// Chooses the usable pbuffer capable framebuffer config closest to the desired
+// one
+//
+static GLboolean choosePbufferFBConfig(const _GLFWfbconfig* desired,
+                                       GLXFBConfig* result)
+{
+    const _GLFWfbconfig* configs;
+    _GLFWfbconfig* usableConfigs;
+    const _GLFWfbconfig* closest;
+    int i, count, usableCount = 0;
+
+    configs = getFBConfigs(&count);
+    if (!configs)
+        return GL_FALSE;
+
+    usableConfigs = calloc(count, sizeof(_GLFWfbconfig));
+
+    for (i = 0;  i < count;  i++)
+    {
+        if (getFBConfigAttrib(configs[i].glx, GLX_DRAWABLE_TYPE) & GLX_PBUFFER_BIT)
+            usableConfigs[usableCount++] = configs[i];
+    }
+
     closest = _glfwChooseFBConfig(desired, usableConfigs, usableCount);
     if (closest)
         *result = closest->glx;
 
-    XFree(nativeConfigs);
     free(usableConfigs);
 
     return closest ? GL_TRUE : GL_FALSE;
 }
 
+// Returns the recorded failure of a context creation attempt, if any
+//
+static const _GLFWfailureGLX* findFailure(GLXFBConfig fbconfig,
+                                          const int* attribs,
+                                          int attribCount)
+{
+    int i;
+
+    for (i = 0;  i < _glfw.glx.failureCount;  i++)
+    {
+        const _GLFWfailureGLX* failure = _glfw.glx.failures + i;
+
+        if (failure->fbconfig == fbconfig &&
+            failure->attribCount == attribCount &&
+            memcmp(failure->attribs, attribs, attribCount * sizeof(int)) == 0)
+        {
+            return failure;
+        }
+    }
+
+    return NULL;
+}
+
+// Records the failure of a context creation attempt
+// Only errors caused by the attributes themselves are recorded, as errors like
+// BadAlloc may not happen again
+//
+static void recordFailure(GLXFBConfig fbconfig,
+                          const int* attribs,
+                          int attribCount,
+                          int errorCode)
+{
+    _GLFWfailureGLX* failures;
+    _GLFWfailureGLX* failure;
+
+    if (errorCode != _glfw.glx.errorBase + GLXBadProfileARB &&
+        errorCode != BadMatch &&
+        errorCode != BadValue)
+    {
+        return;
+    }
+
+    failures = realloc(_glfw.glx.failures,
+                       (_glfw.glx.failureCount + 1) * sizeof(_GLFWfailureGLX));
+    if (!failures)
+        return;
+
+    failure = failures + _glfw.glx.failureCount;
+    memset(failure, 0, sizeof(_GLFWfailureGLX));
+    failure->fbconfig = fbconfig;
+    memcpy(failure->attribs, attribs, attribCount * sizeof(int));
+    failure->attribCount = attribCount;
+    failure->errorCode = errorCode;
+
+    _glfw.glx.failures = failures;
+    _glfw.glx.failureCount++;
+}
+
 // Create the OpenGL context using legacy API
 //
 static GLXContext createLegacyContext(_GLFWwindow* window,
@@ -156,6 +287,93 @@ static GLXContext createLegacyContext(_GLFWwindow* window,
                                True);
 }
 
+// Returns the drawable the specified window renders to
+//
+static GLXDrawable getDrawable(_GLFWwindow* window)
+{
+    // Offscreen contexts draw to their pbuffer
+    if (window->glx.pbuffer)
+        return window->glx.pbuffer;
+
+    return window->x11.handle;
+}
+
+// Returns the swap interval of the window drawable of the specified window
+// This requires GLX_EXT_swap_control
+//
+static int getSwapIntervalEXT(_GLFWwindow* window)
+{
+    int interval;
+    unsigned int value = 0;
+
+    glXQueryDrawable(_glfw.x11.display,
+                     window->x11.handle,
+                     GLX_SWAP_INTERVAL_EXT,
+                     &value);
+    interval = (int) value;
+
+    if (_glfw.glx.EXT_swap_control_tear)
+    {
+        glXQueryDrawable(_glfw.x11.display,
+                         window->x11.handle,
+                         GLX_LATE_SWAPS_TEAR_EXT,
+                         &value);
+        if (value)
+            interval = -interval;
+    }
+
+    return interval;
+}
+
+// Returns whether a context created for one GLXFBConfig may render to
+// a drawable created for the other
+//
+static GLboolean isCompatibleFBConfig(GLXFBConfig first, GLXFBConfig second)
+{
+    int i;
+    const int attribs[] =
+    {
+        GLX_RENDER_TYPE,
+        GLX_DOUBLEBUFFER,
+        GLX_STEREO,
+        GLX_RED_SIZE,
+        GLX_GREEN_SIZE,
+        GLX_BLUE_SIZE,
+        GLX_ALPHA_SIZE,
+        GLX_DEPTH_SIZE,
+        GLX_STENCIL_SIZE,
+        GLX_ACCUM_RED_SIZE,
+        GLX_ACCUM_GREEN_SIZE,
+        GLX_ACCUM_BLUE_SIZE,
+        GLX_ACCUM_ALPHA_SIZE,
+        GLX_AUX_BUFFERS
+    };
+    const int count = sizeof(attribs) / sizeof(int);
+
+    if (first == second)
+        return GL_TRUE;
+
+    for (i = 0;  i < count;  i++)
+    {
+        if (getFBConfigAttrib(first, attribs[i]) !=
+            getFBConfigAttrib(second, attribs[i]))
+        {
+            return GL_FALSE;
+        }
+    }
+
+    if (_glfw.glx.ARB_multisample)
+    {
+        if (getFBConfigAttrib(first, GLX_SAMPLES) !=
+            getFBConfigAttrib(second, GLX_SAMPLES))
+        {
+            return GL_FALSE;
+        }
+    }
+
+    return GL_TRUE;
+}
+
 
 //////////////////////////////////////////////////////////////////////////
 //////                       GLFW internal API                      //////
@@ -165,16 +383,40 @@ static GLXContext createLegacyContext(_GLFWwindow* window,
 //
 int _glfwInitContextAPI(void)
 {
-#ifdef _GLFW_DLOPEN_LIBGL
     int i;
-    char* libGL_names[ ] =
+    const char* extensions;
+    const char* libGL_names[] =
     {
-        "libGL.so",
         "libGL.so.1",
-        "/usr/lib/libGL.so",
-        "/usr/lib/libGL.so.1",
+        "libGL.so",
         NULL
     };
+    const struct
+    {
+        const char* name;
+        void** address;
+    } entries[] =
+    {
+        { "glXGetFBConfigs", (void**) &_glfw.glx.GetFBConfigs },
+        { "glXGetFBConfigAttrib", (void**) &_glfw.glx.GetFBConfigAttrib },
+        { "glXGetClientString", (void**) &_glfw.glx.GetClientString },
+        { "glXQueryExtension", (void**) &_glfw.glx.QueryExtension },
+        { "glXQueryVersion", (void**) &_glfw.glx.QueryVersion },
+        { "glXQueryExtensionsString", (void**) &_glfw.glx.QueryExtensionsString },
+        { "glXCreateNewContext", (void**) &_glfw.glx.CreateNewContext },
+        { "glXDestroyContext", (void**) &_glfw.glx.DestroyContext },
+        { "glXMakeCurrent", (void**) &_glfw.glx.MakeCurrent },
+        { "glXMakeContextCurrent", (void**) &_glfw.glx.MakeContextCurrent },
+        { "glXQueryDrawable", (void**) &_glfw.glx.QueryDrawable },
+        { "glXSwapBuffers", (void**) &_glfw.glx.SwapBuffers },
+        { "glXGetVisualFromFBConfig", (void**) &_glfw.glx.GetVisualFromFBConfig },
+        { "glXCreatePbuffer", (void**) &_glfw.glx.CreatePbuffer },
+        { "glXDestroyPbuffer", (void**) &_glfw.glx.DestroyPbuffer },
+        { "glGetString", (void**) &_glfw.glx.GetString },
+        { "glGetIntegerv", (void**) &_glfw.glx.GetIntegerv },
+        { "glClear", (void**) &_glfw.glx.Clear }
+    };
+    const int count = sizeof(entries) / sizeof(entries[0]);
 
     for (i = 0;  libGL_names[i] != NULL;  i++)
     {
@@ -185,17 +427,40 @@ int _glfwInitContextAPI(void)
 
     if (!_glfw.glx.libGL)
     {
-        _glfwInputError(GLFW_PLATFORM_ERROR, "GLX: Failed to find libGL");
+        _glfwInputError(GLFW_API_UNAVAILABLE, "GLX: Failed to find libGL");
         return GL_FALSE;
     }
-#endif
 
+    for (i = 0;  i < count;  i++)
+    {
+        *entries[i].address = dlsym(_glfw.glx.libGL, entries[i].name);
+        if (!*entries[i].address)
+        {
+            _glfwInputError(GLFW_API_UNAVAILABLE,
+                            "GLX: Failed to load %s", entries[i].name);
+            return GL_FALSE;
+        }
+    }
+
+    // Every variant returns the same function pointer type
+    _glfw.glx.GetProcAddress = (GLXGETPROCADDRESS_T)
+        dlsym(_glfw.glx.libGL, "glXGetProcAddressARB");
+    if (!_glfw.glx.GetProcAddress)
+    {
+        _glfw.glx.GetProcAddress = (GLXGETPROCADDRESS_T)
+            dlsym(_glfw.glx.libGL, "glXGetProcAddress");
+    }
+
+#if !defined(_GLFW_TLS)
     if (pthread_key_create(&_glfw.glx.current, NULL) != 0)
     {
         _glfwInputError(GLFW_PLATFORM_ERROR,
                         "GLX: Failed to create context TLS");
         return GL_FALSE;
     }
+#endif
+
+    pthread_mutex_init(&_glfw.glx.procLock, NULL);
 
     // Check if GLX is supported on this display
     if (!glXQueryExtension(_glfw.x11.display,
@@ -215,6 +480,11 @@ int _glfwInitContextAPI(void)
         return GL_FALSE;
     }
 
+    // The extension string is constant for the display, so it is parsed once
+    extensions = glXQueryExtensionsString(_glfw.x11.display, _glfw.x11.screen);
+    if (extensions)
+        _glfwInitExtensionSet(&_glfw.glx.extensions, extensions);
+
     if (_glfwPlatformExtensionSupported("GLX_EXT_swap_control"))
     {
         _glfw.glx.SwapIntervalEXT = (PFNGLXSWAPINTERVALEXTPROC)
@@ -224,6 +494,12 @@ int _glfwInitContextAPI(void)
             _glfw.glx.EXT_swap_control = GL_TRUE;
     }
 
+    if (_glfw.glx.EXT_swap_control &&
+        _glfwPlatformExtensionSupported("GLX_EXT_swap_control_tear"))
+    {
+        _glfw.glx.EXT_swap_control_tear = GL_TRUE;
+    }
+
     if (_glfwPlatformExtensionSupported("GLX_SGI_swap_control"))
     {
         _glfw.glx.SwapIntervalSGI = (PFNGLXSWAPINTERVALSGIPROC)
@@ -242,6 +518,17 @@ int _glfwInitContextAPI(void)
             _glfw.glx.MESA_swap_control = GL_TRUE;
     }
 
+    if (_glfwPlatformExtensionSupported("GLX_OML_sync_control"))
+    {
+        _glfw.glx.GetSyncValuesOML = (PFNGLXGETSYNCVALUESOMLPROC)
+            _glfwPlatformGetProcAddress("glXGetSyncValuesOML");
+        _glfw.glx.WaitForMscOML = (PFNGLXWAITFORMSCOMLPROC)
+            _glfwPlatformGetProcAddress("glXWaitForMscOML");
+
+        if (_glfw.glx.GetSyncValuesOML && _glfw.glx.WaitForMscOML)
+            _glfw.glx.OML_sync_control = GL_TRUE;
+    }
+
     if (_glfwPlatformExtensionSupported("GLX_ARB_multisample"))
         _glfw.glx.ARB_multisample = GL_TRUE;
 
@@ -260,6 +547,12 @@ int _glfwInitContextAPI(void)
     if (_glfwPlatformExtensionSupported("GLX_ARB_create_context_robustness"))
         _glfw.glx.ARB_create_context_robustness = GL_TRUE;
 
+    if (_glfwPlatformExtensionSupported("GLX_ARB_context_flush_control"))
+        _glfw.glx.ARB_context_flush_control = GL_TRUE;
+
+    if (_glfwPlatformExtensionSupported("GLX_ARB_create_context_no_error"))
+        _glfw.glx.ARB_create_context_no_error = GL_TRUE;
+
     if (_glfwPlatformExtensionSupported("GLX_ARB_create_context_profile"))
         _glfw.glx.ARB_create_context_profile = GL_TRUE;
 
@@ -279,16 +572,31 @@ int _glfwInitContextAPI(void)
 //
 void _glfwTerminateContextAPI(void)
 {
+    _glfwFreeExtensionSet(&_glfw.glx.extensions);
+
+    if (_glfw.glx.nativeConfigs)
+        XFree(_glfw.glx.nativeConfigs);
+
+    free(_glfw.glx.fbconfigs);
+    free(_glfw.glx.failures);
+
+    _glfw.glx.nativeConfigs = NULL;
+    _glfw.glx.fbconfigs = NULL;
+    _glfw.glx.fbconfigCount = 0;
+    _glfw.glx.failures = NULL;
+    _glfw.glx.failureCount = 0;
+
     // Unload libGL.so if necessary
-#ifdef _GLFW_DLOPEN_LIBGL
     if (_glfw.glx.libGL != NULL)
     {
         dlclose(_glfw.glx.libGL);
         _glfw.glx.libGL = NULL;
     }
-#endif
 
+    pthread_mutex_destroy(&_glfw.glx.procLock);
+#if !defined(_GLFW_TLS)
     pthread_key_delete(_glfw.glx.current);
+#endif
 }
 
 #define setGLXattrib(attribName, attribValue) \
@@ -298,35 +606,19 @@ void _glfwTerminateContextAPI(void)
     assert((size_t) index < sizeof(attribs) / sizeof(attribs[0])); \
 }
 
-// Prepare for creation of the OpenGL context
+// Creates the OpenGL context for the specified GLXFBConfig
 //
-int _glfwCreateContext(_GLFWwindow* window,
-                       const _GLFWctxconfig* ctxconfig,
-                       const _GLFWfbconfig* fbconfig)
+static GLboolean createContext(_GLFWwindow* window,
+                               const _GLFWctxconfig* ctxconfig,
+                               GLXFBConfig native)
 {
     int attribs[40];
-    GLXFBConfig native;
     GLXContext share = NULL;
 
     if (ctxconfig->share)
         share = ctxconfig->share->glx.context;
 
-    if (!chooseFBConfig(fbconfig, &native))
-    {
-        _glfwInputError(GLFW_PLATFORM_ERROR,
-                        "GLX: Failed to find a suitable GLXFBConfig");
-        return GL_FALSE;
-    }
-
-    // Retrieve the corresponding visual
-    window->glx.visual = glXGetVisualFromFBConfig(_glfw.x11.display, native);
-
-    if (window->glx.visual == NULL)
-    {
-        _glfwInputError(GLFW_PLATFORM_ERROR,
-                        "GLX: Failed to retrieve visual for GLXFBConfig");
-        return GL_FALSE;
-    }
+    window->glx.fbconfig = native;
 
     if (ctxconfig->api == GLFW_OPENGL_ES_API)
     {
@@ -369,6 +661,7 @@ int _glfwCreateContext(_GLFWwindow* window,
     if (_glfw.glx.ARB_create_context)
     {
         int index = 0, mask = 0, flags = 0, strategy = 0;
+        const _GLFWfailureGLX* failure;
 
         if (ctxconfig->api == GLFW_OPENGL_API)
         {
@@ -421,14 +714,52 @@ int _glfwCreateContext(_GLFWwindow* window,
         if (strategy)
             setGLXattrib(GLX_CONTEXT_RESET_NOTIFICATION_STRATEGY_ARB, strategy);
 
+        if (ctxconfig->noerror && _glfw.glx.ARB_create_context_no_error)
+            setGLXattrib(GLX_CONTEXT_OPENGL_NO_ERROR_ARB, GL_TRUE);
+
+        if (ctxconfig->release && _glfw.glx.ARB_context_flush_control)
+        {
+            if (ctxconfig->release == GLFW_RELEASE_BEHAVIOR_NONE)
+            {
+                setGLXattrib(GLX_CONTEXT_RELEASE_BEHAVIOR_ARB,
+                             GLX_CONTEXT_RELEASE_BEHAVIOR_NONE_ARB);
+            }
+            else if (ctxconfig->release == GLFW_RELEASE_BEHAVIOR_FLUSH)
+            {
+                setGLXattrib(GLX_CONTEXT_RELEASE_BEHAVIOR_ARB,
+                             GLX_CONTEXT_RELEASE_BEHAVIOR_FLUSH_ARB);
+            }
+        }
+
         setGLXattrib(None, None);
 
-        window->glx.context =
-            _glfw.glx.CreateContextAttribsARB(_glfw.x11.display,
-                                              native,
-                                              share,
-                                              True,
-                                              attribs);
+        // Attempts that failed before are not repeated, as each failure costs
+        // a round trip and an X error
+        // NOTE: Attempts with a share context are neither checked nor recorded,
+        //       as the share context itself may be the cause of the failure
+
+        failure = share ? NULL : findFailure(native, attribs, index);
+        if (failure)
+        {
+            window->glx.context = NULL;
+            _glfw.x11.errorCode = failure->errorCode;
+        }
+        else
+        {
+            window->glx.context =
+                _glfw.glx.CreateContextAttribsARB(_glfw.x11.display,
+                                                  native,
+                                                  share,
+                                                  True,
+                                                  attribs);
+
+            if (window->glx.context == NULL && !share)
+            {
+                // Make sure the error for this request has arrived
+                XSync(_glfw.x11.display, False);
+                recordFailure(native, attribs, index, _glfw.x11.errorCode);
+            }
+        }
 
         if (window->glx.context == NULL)
         {
@@ -461,10 +792,44 @@ int _glfwCreateContext(_GLFWwindow* window,
 
 #undef setGLXattrib
 
+// Prepare for creation of the OpenGL context
+//
+int _glfwCreateContext(_GLFWwindow* window,
+                       const _GLFWctxconfig* ctxconfig,
+                       const _GLFWfbconfig* fbconfig)
+{
+    GLXFBConfig native;
+
+    if (!chooseFBConfig(fbconfig, &native))
+    {
+        _glfwInputError(GLFW_PLATFORM_ERROR,
+                        "GLX: Failed to find a suitable GLXFBConfig");
+        return GL_FALSE;
+    }
+
+    // Retrieve the corresponding visual
+    window->glx.visual = glXGetVisualFromFBConfig(_glfw.x11.display, native);
+
+    if (window->glx.visual == NULL)
+    {
+        _glfwInputError(GLFW_PLATFORM_ERROR,
+                        "GLX: Failed to retrieve visual for GLXFBConfig");
+        return GL_FALSE;
+    }
+
+    return createContext(window, ctxconfig, native);
+}
+
 // Destroy the OpenGL context
 //
 void _glfwDestroyContext(_GLFWwindow* window)
 {
+    if (window->glx.pbuffer)
+    {
+        glXDestroyPbuffer(_glfw.x11.display, window->glx.pbuffer);
+        window->glx.pbuffer = None;
+    }
+
     if (window->glx.visual)
     {
         XFree(window->glx.visual);
@@ -483,23 +848,96 @@ void _glfwDestroyContext(_GLFWwindow* window)
 //////                       GLFW platform API                      //////
 //////////////////////////////////////////////////////////////////////////
 
+int _glfwPlatformCreateOffscreenContext(_GLFWwindow* window,
+                                        const _GLFWctxconfig* ctxconfig,
+                                        const _GLFWfbconfig* fbconfig)
+{
+    GLXFBConfig native;
+    const int attribs[] =
+    {
+        GLX_PBUFFER_WIDTH, 1,
+        GLX_PBUFFER_HEIGHT, 1,
+        None
+    };
+
+    if (!choosePbufferFBConfig(fbconfig, &native))
+    {
+        _glfwInputError(GLFW_PLATFORM_ERROR,
+                        "GLX: Failed to find a suitable pbuffer GLXFBConfig");
+        return GL_FALSE;
+    }
+
+    if (!createContext(window, ctxconfig, native))
+        return GL_FALSE;
+
+    // The context needs a drawable to be made current without
+    // GLX_ARB_create_context, so it gets the smallest possible pbuffer
+    _glfwGrabXErrorHandler();
+
+    window->glx.pbuffer = glXCreatePbuffer(_glfw.x11.display, native, attribs);
+
+    _glfwReleaseXErrorHandler();
+
+    if (_glfw.x11.errorCode != Success)
+        window->glx.pbuffer = None;
+
+    if (!window->glx.pbuffer)
+    {
+        _glfwInputXError(GLFW_PLATFORM_ERROR, "GLX: Failed to create pbuffer");
+        return GL_FALSE;
+    }
+
+    return GL_TRUE;
+}
+
 void _glfwPlatformMakeContextCurrent(_GLFWwindow* window)
 {
     if (window)
     {
         glXMakeCurrent(_glfw.x11.display,
-                       window->x11.handle,
+                       getDrawable(window),
                        window->glx.context);
     }
     else
         glXMakeCurrent(_glfw.x11.display, None, NULL);
 
+#if defined(_GLFW_TLS)
+    _glfwCurrentWindow = window;
+#else
     pthread_setspecific(_glfw.glx.current, window);
+#endif
+}
+
+int _glfwPlatformMakeContextCurrentOn(_GLFWwindow* window, _GLFWwindow* target)
+{
+    const GLXDrawable drawable = getDrawable(target);
+
+    if (!isCompatibleFBConfig(window->glx.fbconfig, target->glx.fbconfig))
+    {
+        _glfwInputError(GLFW_INVALID_VALUE,
+                        "GLX: The framebuffer of the target window is not compatible with the context");
+        return GL_FALSE;
+    }
+
+    glXMakeContextCurrent(_glfw.x11.display,
+                          drawable, drawable,
+                          window->glx.context);
+
+#if defined(_GLFW_TLS)
+    _glfwCurrentWindow = window;
+#else
+    pthread_setspecific(_glfw.glx.current, window);
+#endif
+    return GL_TRUE;
 }
 
 _GLFWwindow* _glfwPlatformGetCurrentContext(void)
 {
+#if defined(_GLFW_TLS)
+    return _glfwCurrentWindow;
+#else
     return (_GLFWwindow*) pthread_getspecific(_glfw.glx.current);
+#endif
 }
 
 void _glfwPlatformSwapBuffers(_GLFWwindow* window)
@@ -507,44 +945,121 @@ void _glfwPlatformSwapBuffers(_GLFWwindow* window)
     glXSwapBuffers(_glfw.x11.display, window->x11.handle);
 }
 
-void _glfwPlatformSwapInterval(int interval)
+int _glfwPlatformSwapInterval(_GLFWwindow* window, int interval)
 {
-    _GLFWwindow* window = _glfwPlatformGetCurrentContext();
+    // Negative intervals request swaps that tear when late, which only
+    // GLX_EXT_swap_control_tear supports, so fall back to regular vsync
+    if (interval < 0 && !_glfw.glx.EXT_swap_control_tear)
+        interval = -interval;
 
     if (_glfw.glx.EXT_swap_control)
     {
         _glfw.glx.SwapIntervalEXT(_glfw.x11.display,
                                   window->x11.handle,
                                   interval);
+
+        // Read back the interval of the drawable, as the driver may override
+        // the request
+        return getSwapIntervalEXT(window);
     }
     else if (_glfw.glx.MESA_swap_control)
-        _glfw.glx.SwapIntervalMESA(interval);
+    {
+        if (_glfw.glx.SwapIntervalMESA(interval) == 0)
+            return interval;
+    }
     else if (_glfw.glx.SGI_swap_control)
     {
-        if (interval > 0)
-            _glfw.glx.SwapIntervalSGI(interval);
+        // GLX_SGI_swap_control cannot disable vsync once it has been enabled
+        if (interval > 0 && _glfw.glx.SwapIntervalSGI(interval) == 0)
+            return interval;
     }
+
+    return window->appliedInterval;
 }
 
-int _glfwPlatformExtensionSupported(const char* extension)
+int _glfwPlatformSwapIntervalNeedsContext(_GLFWwindow* window)
 {
-    const GLubyte* extensions;
+    // GLX_EXT_swap_control sets the interval of a drawable, while the MESA
+    // and SGI extensions set that of the current context
+    return !_glfw.glx.EXT_swap_control;
+}
 
-    // Get list of GLX extensions
-    extensions = (const GLubyte*) glXQueryExtensionsString(_glfw.x11.display,
-                                                           _glfw.x11.screen);
-    if (extensions != NULL)
-    {
-        if (_glfwStringInExtensionString(extension, extensions))
-            return GL_TRUE;
-    }
+int _glfwPlatformGetSwapInterval(_GLFWwindow* window)
+{
+    int interval;
+
+    // Without GLX_EXT_swap_control the interval cannot be queried
+    if (!_glfw.glx.EXT_swap_control)
+        return window->appliedInterval;
+
+    // The query fails if the driver has no drawable state for the window,
+    // which is not the case while a context is current on it
+    _glfwGrabXErrorHandler();
+    interval = getSwapIntervalEXT(window);
+    _glfwReleaseXErrorHandler();
+
+    if (_glfw.x11.errorCode != Success)
+        return window->appliedInterval;
+
+    return interval;
+}
+
+int _glfwPlatformGetSyncValues(_GLFWwindow* window,
+                               int64_t* ust, int64_t* msc, int64_t* sbc)
+{
+    if (!_glfw.glx.OML_sync_control)
+        return GL_FALSE;
+
+    return _glfw.glx.GetSyncValuesOML(_glfw.x11.display,
+                                      window->x11.handle,
+                                      ust, msc, sbc);
+}
+
+int _glfwPlatformWaitForMSC(_GLFWwindow* window, int64_t msc)
+{
+    int64_t ust, sbc;
+
+    if (!_glfw.glx.OML_sync_control)
+        return GL_FALSE;
 
-    return GL_FALSE;
+    // A divisor of zero waits until the MSC is at least the target
+    return _glfw.glx.WaitForMscOML(_glfw.x11.display,
+                                   window->x11.handle,
+                                   msc, 0, 0,
+                                   &ust, &msc, &sbc);
+}
+
+int _glfwPlatformExtensionSupported(const char* extension)
+{
+    return _glfwExtensionInSet(&_glfw.glx.extensions, extension);
+}
+
+const _GLFWfbconfig* _glfwPlatformGetFramebufferConfigs(int* count)
+{
+    return getFBConfigs(count);
 }
 
 GLFWglproc _glfwPlatformGetProcAddress(const char* procname)
 {
-    return _glfw_glXGetProcAddress((const GLubyte*) procname);
+    if (_glfw.glx.GetProcAddress)
+        return _glfw.glx.GetProcAddress((const GLubyte*) procname);
+
+    return (GLFWglproc) dlsym(_glfw.glx.libGL, procname);
+}
+
+void _glfwPlatformLockProcCache(void)
+{
+    pthread_mutex_lock(&_glfw.glx.procLock);
+}
+
+void _glfwPlatformUnlockProcCache(void)
+{
+    pthread_mutex_unlock(&_glfw.glx.procLock);
+}
+
+int _glfwPlatformGetPixelFormatID(_GLFWwindow* window)
+{
+    return getFBConfigAttrib(window->glx.fbconfig, GLX_FBCONFIG_ID);
 }
 
 
@@ -36,33 +36,64 @@
 // extensions and not all operating systems come with an up-to-date version
 #include "../deps/GL/glxext.h"
 
-// Do we have support for dlopen/dlsym?
-#if defined(_GLFW_HAS_DLOPEN)
- #include <dlfcn.h>
-#endif
+// libGL is loaded at run-time
+#include <dlfcn.h>
 
 #include <pthread.h>
 
-// We support four different ways for getting addresses for GL/GLX
-// extension functions: glXGetProcAddress, glXGetProcAddressARB,
-// glXGetProcAddressEXT, and dlsym
-#if defined(_GLFW_HAS_GLXGETPROCADDRESSARB)
- #define _glfw_glXGetProcAddress(x) glXGetProcAddressARB(x)
-#elif defined(_GLFW_HAS_GLXGETPROCADDRESS)
- #define _glfw_glXGetProcAddress(x) glXGetProcAddress(x)
-#elif defined(_GLFW_HAS_GLXGETPROCADDRESSEXT)
- #define _glfw_glXGetProcAddress(x) glXGetProcAddressEXT(x)
-#elif defined(_GLFW_HAS_DLOPEN)
- #define _glfw_glXGetProcAddress(x) dlsym(_glfw.glx.libGL, x)
- #define _GLFW_DLOPEN_LIBGL
-#else
- #error "No OpenGL entry point retrieval mechanism was enabled"
-#endif
+// libGL function pointer typedefs
+typedef GLXFBConfig* (* GLXGETFBCONFIGS_T)(Display*,int,int*);
+typedef int (* GLXGETFBCONFIGATTRIB_T)(Display*,GLXFBConfig,int,int*);
+typedef const char* (* GLXGETCLIENTSTRING_T)(Display*,int);
+typedef Bool (* GLXQUERYEXTENSION_T)(Display*,int*,int*);
+typedef Bool (* GLXQUERYVERSION_T)(Display*,int*,int*);
+typedef const char* (* GLXQUERYEXTENSIONSSTRING_T)(Display*,int);
+typedef GLXContext (* GLXCREATENEWCONTEXT_T)(Display*,GLXFBConfig,int,GLXContext,Bool);
+typedef void (* GLXDESTROYCONTEXT_T)(Display*,GLXContext);
+typedef Bool (* GLXMAKECURRENT_T)(Display*,GLXDrawable,GLXContext);
+typedef Bool (* GLXMAKECONTEXTCURRENT_T)(Display*,GLXDrawable,GLXDrawable,GLXContext);
+typedef void (* GLXQUERYDRAWABLE_T)(Display*,GLXDrawable,int,unsigned int*);
+typedef void (* GLXSWAPBUFFERS_T)(Display*,GLXDrawable);
+typedef XVisualInfo* (* GLXGETVISUALFROMFBCONFIG_T)(Display*,GLXFBConfig);
+typedef GLXPbuffer (* GLXCREATEPBUFFER_T)(Display*,GLXFBConfig,const int*);
+typedef void (* GLXDESTROYPBUFFER_T)(Display*,GLXPbuffer);
+typedef GLFWglproc (* GLXGETPROCADDRESS_T)(const GLubyte*);
+typedef const GLubyte* (* GLGETSTRING_T)(GLenum);
+typedef void (* GLGETINTEGERV_T)(GLenum,GLint*);
+typedef void (* GLCLEAR_T)(GLbitfield);
+
+// libGL shortcuts
+#define glXGetFBConfigs _glfw.glx.GetFBConfigs
+#define glXGetFBConfigAttrib _glfw.glx.GetFBConfigAttrib
+#define glXGetClientString _glfw.glx.GetClientString
+#define glXQueryExtension _glfw.glx.QueryExtension
+#define glXQueryVersion _glfw.glx.QueryVersion
+#define glXQueryExtensionsString _glfw.glx.QueryExtensionsString
+#define glXCreateNewContext _glfw.glx.CreateNewContext
+#define glXDestroyContext _glfw.glx.DestroyContext
+#define glXMakeCurrent _glfw.glx.MakeCurrent
+#define glXMakeContextCurrent _glfw.glx.MakeContextCurrent
+#define glXQueryDrawable _glfw.glx.QueryDrawable
+#define glXSwapBuffers _glfw.glx.SwapBuffers
+#define glXGetVisualFromFBConfig _glfw.glx.GetVisualFromFBConfig
+#define glXCreatePbuffer _glfw.glx.CreatePbuffer
+#define glXDestroyPbuffer _glfw.glx.DestroyPbuffer
+
+// The shared code calls these to query the context
+#define glGetString _glfw.glx.GetString
+#define glGetIntegerv _glfw.glx.GetIntegerv
+#define glClear _glfw.glx.Clear
 
 #define _GLFW_PLATFORM_FBCONFIG             GLXFBConfig     glx
 #define _GLFW_PLATFORM_CONTEXT_STATE        _GLFWcontextGLX glx
 #define _GLFW_PLATFORM_LIBRARY_OPENGL_STATE _GLFWlibraryGLX glx
 
+// Thread local storage attribute macro, where the compiler provides one
+// Otherwise the current context is tracked with a pthread key
+#if defined(__GNUC__)
+ #define _GLFW_TLS __thread
+#endif
+
 #ifndef GLX_MESA_swap_control
 typedef int (*PFNGLXSWAPINTERVALMESAPROC)(int);
 #endif
@@ -77,12 +108,27 @@ typedef int (*PFNGLXSWAPINTERVALMESAPROC)(int);
 //------------------------------------------------------------------------
 typedef struct _GLFWcontextGLX
 {
-    GLXContext      context; // OpenGL rendering context
-    XVisualInfo*    visual;  // Visual for selected GLXFBConfig
+    GLXContext      context;  // OpenGL rendering context
+    GLXFBConfig     fbconfig; // GLXFBConfig of the context
+    XVisualInfo*    visual;   // Visual for selected GLXFBConfig
+    GLXPbuffer      pbuffer;  // Drawable of offscreen contexts
 
 } _GLFWcontextGLX;
 
 
+//------------------------------------------------------------------------
+// Context creation attempt known to fail
+//------------------------------------------------------------------------
+typedef struct _GLFWfailureGLX
+{
+    GLXFBConfig     fbconfig;
+    int             attribs[40];
+    int             attribCount;
+    int             errorCode;
+
+} _GLFWfailureGLX;
+
+
 //------------------------------------------------------------------------
 // Platform-specific library global data for GLX
 //------------------------------------------------------------------------
@@ -93,27 +139,68 @@ typedef struct _GLFWlibraryGLX
     int             eventBase;
     int             errorBase;
 
+#if !defined(_GLFW_TLS)
     // TLS key for per-thread current context/window
     pthread_key_t   current;
+#endif
+    // Lock for the context function pointer caches
+    pthread_mutex_t procLock;
+
+    // GLX extensions supported by the screen
+    _GLFWextensions extensions;
+
+    // Usable GLXFBConfigs of the screen, translated on first use
+    GLXFBConfig*    nativeConfigs;
+    _GLFWfbconfig*  fbconfigs;
+    int             fbconfigCount;
+
+    // Context creation attempts that failed, so they are not repeated
+    _GLFWfailureGLX* failures;
+    int             failureCount;
+
+    // dlopen handle for libGL.so and its entry points
+    void*           libGL;
+    GLXGETFBCONFIGS_T GetFBConfigs;
+    GLXGETFBCONFIGATTRIB_T GetFBConfigAttrib;
+    GLXGETCLIENTSTRING_T GetClientString;
+    GLXQUERYEXTENSION_T QueryExtension;
+    GLXQUERYVERSION_T QueryVersion;
+    GLXQUERYEXTENSIONSSTRING_T QueryExtensionsString;
+    GLXCREATENEWCONTEXT_T CreateNewContext;
+    GLXDESTROYCONTEXT_T DestroyContext;
+    GLXMAKECURRENT_T MakeCurrent;
+    GLXMAKECONTEXTCURRENT_T MakeContextCurrent;
+    GLXQUERYDRAWABLE_T QueryDrawable;
+    GLXSWAPBUFFERS_T SwapBuffers;
+    GLXGETVISUALFROMFBCONFIG_T GetVisualFromFBConfig;
+    GLXCREATEPBUFFER_T CreatePbuffer;
+    GLXDESTROYPBUFFER_T DestroyPbuffer;
+    GLXGETPROCADDRESS_T GetProcAddress;
+    GLGETSTRING_T GetString;
+    GLGETINTEGERV_T GetIntegerv;
+    GLCLEAR_T Clear;
 
     // GLX extensions
     PFNGLXSWAPINTERVALSGIPROC             SwapIntervalSGI;
     PFNGLXSWAPINTERVALEXTPROC             SwapIntervalEXT;
     PFNGLXSWAPINTERVALMESAPROC            SwapIntervalMESA;
     PFNGLXCREATECONTEXTATTRIBSARBPROC     CreateContextAttribsARB;
+    PFNGLXGETSYNCVALUESOMLPROC            GetSyncValuesOML;
+    PFNGLXWAITFORMSCOMLPROC               WaitForMscOML;
     GLboolean       SGI_swap_control;
     GLboolean       EXT_swap_control;
+    GLboolean       EXT_swap_control_tear;
     GLboolean       MESA_swap_control;
+    GLboolean       OML_sync_control;
     GLboolean       ARB_multisample;
     GLboolean       ARB_framebuffer_sRGB;
     GLboolean       ARB_create_context;
     GLboolean       ARB_create_context_profile;
     GLboolean       ARB_create_context_robustness;
+    GLboolean       ARB_create_context_no_error;
+    GLboolean       ARB_context_flush_control;
     GLboolean       EXT_create_context_es2_profile;
 
-#if defined(_GLFW_DLOPEN_LIBGL)
-    void*           libGL;  // dlopen handle for libGL.so
-#endif
 } _GLFWlibraryGLX;
 
 
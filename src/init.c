@@ -152,9 +152,11 @@ GLFWAPI void glfwTerminate(void)
 
     memset(&_glfw.callbacks, 0, sizeof(_glfw.callbacks));
 
-    // Close all remaining windows
+    // Close all remaining windows and offscreen contexts
     while (_glfw.windowListHead)
         glfwDestroyWindow((GLFWwindow*) _glfw.windowListHead);
+    while (_glfw.offscreenListHead)
+        glfwDestroyWindow((GLFWwindow*) _glfw.offscreenListHead);
 
     for (i = 0;  i < _glfw.monitorCount;  i++)
     {
@@ -167,6 +169,12 @@ GLFWAPI void glfwTerminate(void)
     _glfw.monitors = NULL;
     _glfw.monitorCount = 0;
 
+    _glfwFreeProcCaches();
+
+    free(_glfw.fbconfigs);
+    _glfw.fbconfigs = NULL;
+    _glfw.fbconfigCount = 0;
+
     _glfwPlatformTerminate();
 
     _glfwInitialized = GL_FALSE;
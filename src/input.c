@@ -30,6 +30,15 @@
 // Internal key state used for sticky keys
 #define _GLFW_STICK 3
 
+// Only cursor samples this many seconds older than the newest one are used
+// for prediction, and a cursor that has not moved for this long is considered
+// to be at rest
+#define _GLFW_PREDICTION_WINDOW 0.05
+
+// Gain of the alpha-beta filter used by smoothed prediction
+// The velocity gain is derived from it for a critically damped response
+#define _GLFW_PREDICTION_ALPHA 0.5
+
 
 // Sets the cursor mode for the specified window
 //
@@ -74,6 +83,20 @@ static void setCursorMode(_GLFWwindow* window, int newMode)
     }
 }
 
+// Sets the cursor prediction filter for the specified window
+//
+static void setCursorPrediction(_GLFWwindow* window, int filter)
+{
+    if (filter != GLFW_PREDICTION_LINEAR &&
+        filter != GLFW_PREDICTION_SMOOTHED)
+    {
+        _glfwInputError(GLFW_INVALID_ENUM, NULL);
+        return;
+    }
+
+    window->cursorPrediction = filter;
+}
+
 // Set sticky keys mode for the specified window
 //
 static void setStickyKeys(_GLFWwindow* window, int enabled)
@@ -118,6 +141,110 @@ static void setStickyMouseButtons(_GLFWwindow* window, int enabled)
     window->stickyMouseButtons = enabled;
 }
 
+// Appends the current cursor position to the cursor history of the window
+//
+static void recordCursorSample(_GLFWwindow* window, double time)
+{
+    GLFWcursorsample* sample =
+        window->cursorHistory.samples + window->cursorHistory.next;
+
+    sample->x = window->cursorPosX;
+    sample->y = window->cursorPosY;
+    sample->time = time;
+
+    window->cursorHistory.next =
+        (window->cursorHistory.next + 1) % _GLFW_CURSOR_HISTORY_SIZE;
+
+    // Once the buffer is full, the oldest sample is overwritten
+    if (window->cursorHistory.count < _GLFW_CURSOR_HISTORY_SIZE)
+        window->cursorHistory.count++;
+    if (window->cursorHistory.unread < _GLFW_CURSOR_HISTORY_SIZE)
+        window->cursorHistory.unread++;
+}
+
+// Returns the cursor sample at the specified age, where zero is the newest
+//
+static const GLFWcursorsample* getCursorSample(_GLFWwindow* window, int age)
+{
+    int index = window->cursorHistory.next - 1 - age;
+    if (index < 0)
+        index += _GLFW_CURSOR_HISTORY_SIZE;
+
+    return window->cursorHistory.samples + index;
+}
+
+// Estimates the cursor velocity as the least squares slope of the samples
+//
+static void estimateLinearVelocity(_GLFWwindow* window, int count,
+                                   double* vx, double* vy)
+{
+    int i;
+    double meanT = 0.0, meanX = 0.0, meanY = 0.0;
+    double varT = 0.0, covX = 0.0, covY = 0.0;
+
+    for (i = 0;  i < count;  i++)
+    {
+        const GLFWcursorsample* sample = getCursorSample(window, i);
+        meanT += sample->time;
+        meanX += sample->x;
+        meanY += sample->y;
+    }
+
+    meanT /= count;
+    meanX /= count;
+    meanY /= count;
+
+    for (i = 0;  i < count;  i++)
+    {
+        const GLFWcursorsample* sample = getCursorSample(window, i);
+        const double dt = sample->time - meanT;
+
+        varT += dt * dt;
+        covX += dt * (sample->x - meanX);
+        covY += dt * (sample->y - meanY);
+    }
+
+    if (varT > 0.0)
+    {
+        *vx = covX / varT;
+        *vy = covY / varT;
+    }
+}
+
+// Estimates the cursor position and velocity with an alpha-beta filter
+//
+static void estimateSmoothedMotion(_GLFWwindow* window, int count,
+                                   double* x, double* y,
+                                   double* vx, double* vy)
+{
+    int i;
+    const double alpha = _GLFW_PREDICTION_ALPHA;
+    const double beta = alpha * alpha / (2.0 - alpha);
+    const GLFWcursorsample* previous = getCursorSample(window, count - 1);
+
+    *x = previous->x;
+    *y = previous->y;
+
+    for (i = count - 2;  i >= 0;  i--)
+    {
+        const GLFWcursorsample* sample = getCursorSample(window, i);
+        const double dt = sample->time - previous->time;
+        const double rx = sample->x - (*x + *vx * dt);
+        const double ry = sample->y - (*y + *vy * dt);
+
+        *x += *vx * dt + alpha * rx;
+        *y += *vy * dt + alpha * ry;
+
+        if (dt > 0.0)
+        {
+            *vx += beta * rx / dt;
+            *vy += beta * ry / dt;
+        }
+
+        previous = sample;
+    }
+}
+
 
 //////////////////////////////////////////////////////////////////////////
 //////                         GLFW event API                       //////
@@ -178,7 +305,7 @@ void _glfwInputMouseClick(_GLFWwindow* window, int button, int action, int mods)
         window->callbacks.mouseButton((GLFWwindow*) window, button, action, mods);
 }
 
-void _glfwInputCursorMotion(_GLFWwindow* window, double x, double y)
+void _glfwInputCursorMotion(_GLFWwindow* window, double x, double y, double time)
 {
     if (window->cursorMode == GLFW_CURSOR_DISABLED)
     {
@@ -197,6 +324,8 @@ void _glfwInputCursorMotion(_GLFWwindow* window, double x, double y)
         window->cursorPosY = y;
     }
 
+    recordCursorSample(window, time);
+
     if (window->callbacks.cursorPos)
     {
         window->callbacks.cursorPos((GLFWwindow*) window,
@@ -236,6 +365,8 @@ GLFWAPI int glfwGetInputMode(GLFWwindow* handle, int mode)
             return window->stickyKeys;
         case GLFW_STICKY_MOUSE_BUTTONS:
             return window->stickyMouseButtons;
+        case GLFW_CURSOR_PREDICTION:
+            return window->cursorPrediction;
         default:
             _glfwInputError(GLFW_INVALID_ENUM, NULL);
             return 0;
@@ -259,6 +390,9 @@ GLFWAPI void glfwSetInputMode(GLFWwindow* handle, int mode, int value)
         case GLFW_STICKY_MOUSE_BUTTONS:
             setStickyMouseButtons(window, value ? GL_TRUE : GL_FALSE);
             break;
+        case GLFW_CURSOR_PREDICTION:
+            setCursorPrediction(window, value);
+            break;
         default:
             _glfwInputError(GLFW_INVALID_ENUM, NULL);
             break;
@@ -348,6 +482,82 @@ GLFWAPI void glfwSetCursorPos(GLFWwindow* handle, double xpos, double ypos)
     _glfwPlatformSetCursorPos(window, xpos, ypos);
 }
 
+GLFWAPI int glfwGetCursorHistory(GLFWwindow* handle,
+                                 GLFWcursorsample* samples,
+                                 int capacity)
+{
+    int i, count, first;
+    _GLFWwindow* window = (_GLFWwindow*) handle;
+
+    _GLFW_REQUIRE_INIT_OR_RETURN(0);
+
+    if (capacity < 0)
+    {
+        _glfwInputError(GLFW_INVALID_VALUE, NULL);
+        return 0;
+    }
+
+    count = window->cursorHistory.unread;
+    if (count > capacity)
+        count = capacity;
+
+    first = window->cursorHistory.next - window->cursorHistory.unread;
+    if (first < 0)
+        first += _GLFW_CURSOR_HISTORY_SIZE;
+
+    for (i = 0;  i < count;  i++)
+    {
+        const int index = (first + i) % _GLFW_CURSOR_HISTORY_SIZE;
+        samples[i] = window->cursorHistory.samples[index];
+    }
+
+    window->cursorHistory.unread -= count;
+    return count;
+}
+
+GLFWAPI void glfwGetPredictedCursorPos(GLFWwindow* handle, double time,
+                                       double* xpos, double* ypos)
+{
+    int count = 0;
+    double x, y, vx = 0.0, vy = 0.0;
+    const GLFWcursorsample* newest;
+    _GLFWwindow* window = (_GLFWwindow*) handle;
+
+    _GLFW_REQUIRE_INIT();
+
+    x = window->cursorPosX;
+    y = window->cursorPosY;
+
+    if (window->cursorHistory.count > 0)
+    {
+        newest = getCursorSample(window, 0);
+
+        if (_glfwPlatformGetTime() - newest->time < _GLFW_PREDICTION_WINDOW)
+        {
+            // Only use the samples belonging to the current movement
+            while (count < window->cursorHistory.count &&
+                   newest->time - getCursorSample(window, count)->time <
+                   _GLFW_PREDICTION_WINDOW)
+            {
+                count++;
+            }
+
+            if (window->cursorPrediction == GLFW_PREDICTION_SMOOTHED)
+                estimateSmoothedMotion(window, count, &x, &y, &vx, &vy);
+            else
+                estimateLinearVelocity(window, count, &vx, &vy);
+
+            x += vx * (time - newest->time);
+            y += vy * (time - newest->time);
+        }
+    }
+
+    if (xpos)
+        *xpos = x;
+    if (ypos)
+        *ypos = y;
+}
+
 GLFWAPI GLFWkeyfun glfwSetKeyCallback(GLFWwindow* handle, GLFWkeyfun cbfun)
 {
     _GLFWwindow* window = (_GLFWwindow*) handle;
@@ -65,6 +65,22 @@ typedef struct _GLFWfbconfig    _GLFWfbconfig;
 typedef struct _GLFWwindow      _GLFWwindow;
 typedef struct _GLFWlibrary     _GLFWlibrary;
 typedef struct _GLFWmonitor     _GLFWmonitor;
+typedef struct _GLFWextensions  _GLFWextensions;
+typedef struct _GLFWproccache   _GLFWproccache;
+
+/*! @brief Hashed set of extension names.
+ *
+ *  This is defined before the platform headers so that context APIs may keep
+ *  their own extension sets.
+ */
+struct _GLFWextensions
+{
+    // Copy of the extension names, each terminated by a NUL character
+    char*           names;
+    // Open addressing hash table of pointers into names
+    const char**    buckets;
+    unsigned int    size;
+};
 
 #if defined(_GLFW_COCOA)
  #include "cocoa_platform.h"
@@ -122,6 +138,9 @@ typedef struct _GLFWmonitor     _GLFWmonitor;
         return x;                                    \
     }
 
+// The number of cursor samples kept per window
+#define _GLFW_CURSOR_HISTORY_SIZE 256
+
 // Swaps the provided pointers
 #define _GLFW_SWAP_POINTERS(x, y) \
     {                             \
@@ -150,6 +169,7 @@ struct _GLFWwndconfig
     GLboolean     resizable;
     GLboolean     visible;
     GLboolean     decorated;
+    GLboolean     borderless;
     _GLFWmonitor* monitor;
 };
 
@@ -169,6 +189,8 @@ struct _GLFWctxconfig
     GLboolean     debug;
     int           profile;
     int           robustness;
+    GLboolean     noerror;
+    int           release;
     _GLFWwindow*  share;
 };
 
@@ -203,6 +225,25 @@ struct _GLFWfbconfig
 };
 
 
+/*! @brief Context function pointer cache.
+ *
+ *  A cache is shared by the contexts of a share group and by contexts with the
+ *  same client API, profile, pixel format, vendor, renderer and version.  Caches are kept
+ *  until the library is terminated and are accessed with the platform proc
+ *  cache lock held.
+ */
+struct _GLFWproccache
+{
+    _GLFWproccache*     next;
+    char*               key;
+    // Open addressing hash table of names and their function pointers
+    char**              names;
+    GLFWglproc*         procs;
+    unsigned int        size;
+    unsigned int        count;
+};
+
+
 /*! @brief Window and context structure.
  */
 struct _GLFWwindow
@@ -213,20 +254,37 @@ struct _GLFWwindow
     GLboolean           iconified;
     GLboolean           resizable;
     GLboolean           decorated;
+    GLboolean           borderless;
+    // Offscreen contexts have no window and are not in the window list
+    GLboolean           offscreen;
     GLboolean           visible;
     GLboolean           closed;
     void*               userPointer;
     GLFWvidmode         videoMode;
     _GLFWmonitor*       monitor;
+    // Swap interval last set with glfwSwapInterval
+    int                 swapInterval;
+    // Swap interval currently applied to the framebuffer of the window, which
+    // glfwSwapBuffersMulti changes while batching swaps
+    int                 appliedInterval;
 
     // Window input state
     GLboolean           stickyKeys;
     GLboolean           stickyMouseButtons;
     double              cursorPosX, cursorPosY;
     int                 cursorMode;
+    int                 cursorPrediction;
     char                mouseButton[GLFW_MOUSE_BUTTON_LAST + 1];
     char                key[GLFW_KEY_LAST + 1];
 
+    // Cursor position history, used as a ring buffer
+    struct {
+        GLFWcursorsample samples[_GLFW_CURSOR_HISTORY_SIZE];
+        int             next;
+        int             count;
+        int             unread;
+    } cursorHistory;
+
     // OpenGL extensions and context attributes
     struct {
         int             api;
@@ -234,6 +292,14 @@ struct _GLFWwindow
         GLboolean       forward, debug;
         int             profile;
         int             robustness;
+        GLboolean       noerror;
+        int             release;
+        _GLFWextensions extensions;
+        _GLFWproccache* procs;
+        // Window whose drawable the context was last made current on
+        _GLFWwindow*    target;
+        // Number of buffer swaps, for estimating the SBC
+        int64_t         swapCount;
     } context;
 
 #if defined(_GLFW_USE_OPENGL)
@@ -278,7 +344,13 @@ struct _GLFWmonitor
     GLFWvidmode     currentMode;
 
     GLFWgammaramp   originalRamp;
+    // The last ramp set or retrieved, until the platform reports a change
     GLFWgammaramp   currentRamp;
+    GLboolean       currentRampValid;
+    // The gamma value and ramp size of the current ramp if it was generated by
+    // glfwSetGamma, or zero
+    float           gamma;
+    unsigned int    gammaSize;
 
     // This is defined in the window API's platform.h
     _GLFW_PLATFORM_MONITOR_STATE;
@@ -305,6 +377,7 @@ struct _GLFWlibrary
         GLboolean   resizable;
         GLboolean   visible;
         GLboolean   decorated;
+        GLboolean   borderless;
         int         samples;
         GLboolean   sRGB;
         int         refreshRate;
@@ -315,18 +388,28 @@ struct _GLFWlibrary
         GLboolean   debug;
         int         profile;
         int         robustness;
+        GLboolean   noerror;
+        int         release;
     } hints;
 
     double          cursorPosX, cursorPosY;
 
     _GLFWwindow*    windowListHead;
+    _GLFWwindow*    offscreenListHead;
     _GLFWwindow*    focusedWindow;
 
+    _GLFWproccache* procCacheListHead;
+
+    GLFWfbconfig*   fbconfigs;
+    int             fbconfigCount;
+
     _GLFWmonitor**  monitors;
     int             monitorCount;
 
     struct {
         GLFWmonitorfun  monitor;
+        GLFWjoystickfun joystick;
+        GLFWjoystickinputfun joystickInput;
     } callbacks;
 
     // This is defined in the window API's platform.h
@@ -415,6 +498,15 @@ GLFWvidmode* _glfwPlatformGetVideoModes(_GLFWmonitor* monitor, int* count);
  */
 void _glfwPlatformGetVideoMode(_GLFWmonitor* monitor, GLFWvidmode* mode);
 
+/*! @brief Retrieves the unreduced refresh rate of the current video mode.
+ *  @param[out] numerator Where to store the numerator, or zero if unknown.
+ *  @param[out] denominator Where to store the denominator.
+ *  @ingroup platform
+ */
+void _glfwPlatformGetVideoModeRefreshRational(_GLFWmonitor* monitor,
+                                              unsigned long* numerator,
+                                              unsigned long* denominator);
+
 /*! @copydoc glfwGetGammaRamp
  *  @ingroup platform
  */
@@ -425,6 +517,14 @@ void _glfwPlatformGetGammaRamp(_GLFWmonitor* monitor, GLFWgammaramp* ramp);
  */
 void _glfwPlatformSetGammaRamp(_GLFWmonitor* monitor, const GLFWgammaramp* ramp);
 
+/*! @brief Returns the native gamma ramp size of the specified monitor.
+ *  @param[in] monitor The monitor to query.
+ *  @return The number of entries in the hardware gamma ramp, or zero if it is
+ *  unknown.
+ *  @ingroup platform
+ */
+int _glfwPlatformGetGammaRampSize(_GLFWmonitor* monitor);
+
 /*! @copydoc glfwSetClipboardString
  *  @ingroup platform
  */
@@ -458,6 +558,16 @@ const unsigned char* _glfwPlatformGetJoystickButtons(int joy, int* count);
  */
 const char* _glfwPlatformGetJoystickName(int joy);
 
+/*! @copydoc glfwSetJoystickSampling
+ *  @ingroup platform
+ */
+void _glfwPlatformSetJoystickSampling(int enabled);
+
+/*! @copydoc glfwGetJoystickHistory
+ *  @ingroup platform
+ */
+int _glfwPlatformGetJoystickHistory(int joy, GLFWjoysticksample* samples, int capacity);
+
 /*! @copydoc glfwGetTime
  *  @ingroup platform
  */
@@ -468,6 +578,12 @@ double _glfwPlatformGetTime(void);
  */
 void _glfwPlatformSetTime(double time);
 
+/*! @brief Suspends the calling thread for the specified time.
+ *  @param[in] seconds The time to sleep, in seconds.
+ *  @ingroup platform
+ */
+void _glfwPlatformSleep(double seconds);
+
 /*! @ingroup platform
  */
 int _glfwPlatformCreateWindow(_GLFWwindow* window,
@@ -544,11 +660,31 @@ void _glfwPlatformWaitEvents(void);
  */
 void _glfwPlatformPostEmptyEvent(void);
 
+/*! @brief Creates a context without a window.
+ *  @param[in] window The window object to hold the context.
+ *  @param[in] ctxconfig The desired context configuration.
+ *  @param[in] fbconfig The desired framebuffer configuration.
+ *  @return `GL_TRUE` if successful, or `GL_FALSE` otherwise.
+ *  @ingroup platform
+ */
+int _glfwPlatformCreateOffscreenContext(_GLFWwindow* window,
+                                        const _GLFWctxconfig* ctxconfig,
+                                        const _GLFWfbconfig* fbconfig);
+
 /*! @copydoc glfwMakeContextCurrent
  *  @ingroup platform
  */
 void _glfwPlatformMakeContextCurrent(_GLFWwindow* window);
 
+/*! @brief Makes the context of the specified window current on the drawable
+ *  of the target window.
+ *  @param[in] window The window whose context to make current.
+ *  @param[in] target The window whose drawable to render to.
+ *  @return `GL_TRUE` if successful, or `GL_FALSE` if an error occurred.
+ *  @ingroup platform
+ */
+int _glfwPlatformMakeContextCurrentOn(_GLFWwindow* window, _GLFWwindow* target);
+
 /*! @copydoc glfwGetCurrentContext
  *  @ingroup platform
  */
@@ -559,10 +695,46 @@ _GLFWwindow* _glfwPlatformGetCurrentContext(void);
  */
 void _glfwPlatformSwapBuffers(_GLFWwindow* window);
 
-/*! @copydoc glfwSwapInterval
+/*! @brief Sets the swap interval of the current context.
+ *  @param[in] window The window whose framebuffer the current context renders
+ *  to.
+ *  @param[in] interval The requested swap interval.
+ *  @return The swap interval actually applied.
  *  @ingroup platform
  */
-void _glfwPlatformSwapInterval(int interval);
+int _glfwPlatformSwapInterval(_GLFWwindow* window, int interval);
+
+/*! @brief Returns the swap interval of the framebuffer of the specified window.
+ *  @param[in] window The window whose context is current.
+ *  @return The swap interval reported by the system, or the last interval
+ *  applied by GLFW if the system cannot report it.
+ *  @ingroup platform
+ */
+int _glfwPlatformGetSwapInterval(_GLFWwindow* window);
+
+/*! @brief Returns whether setting the swap interval of the specified window
+ *  requires its context to be current.
+ *  @param[in] window The window to query.
+ *  @return `GL_TRUE` if the context must be current, or `GL_FALSE` if the
+ *  interval can be set from any thread.
+ *  @ingroup platform
+ */
+int _glfwPlatformSwapIntervalNeedsContext(_GLFWwindow* window);
+
+/*! @brief Retrieves the UST, MSC and SBC of the specified window.
+ *  @return `GL_TRUE` if successful, or `GL_FALSE` if the values are not
+ *  available.
+ *  @ingroup platform
+ */
+int _glfwPlatformGetSyncValues(_GLFWwindow* window,
+                               int64_t* ust, int64_t* msc, int64_t* sbc);
+
+/*! @brief Waits until the MSC of the specified window reaches the value.
+ *  @return `GL_TRUE` if successful, or `GL_FALSE` if the MSC is not
+ *  available.
+ *  @ingroup platform
+ */
+int _glfwPlatformWaitForMSC(_GLFWwindow* window, int64_t msc);
 
 /*! @ingroup platform
  */
@@ -573,6 +745,33 @@ int _glfwPlatformExtensionSupported(const char* extension);
  */
 GLFWglproc _glfwPlatformGetProcAddress(const char* procname);
 
+/*! @brief Returns the usable framebuffer configs of the context API.
+ *  @param[out] count The number of configs in the returned array.
+ *  @return The cached array of configs, or `NULL` if none are available.
+ *  @ingroup platform
+ */
+const _GLFWfbconfig* _glfwPlatformGetFramebufferConfigs(int* count);
+
+/*! @brief Locks the context function pointer caches.
+ *
+ *  The caches may be shared by contexts current on different threads.
+ *
+ *  @ingroup platform
+ */
+void _glfwPlatformLockProcCache(void);
+
+/*! @brief Unlocks the context function pointer caches.
+ *  @ingroup platform
+ */
+void _glfwPlatformUnlockProcCache(void);
+
+/*! @brief Returns an identifier for the pixel format of the specified context.
+ *  @param[in] window The window whose context to query.
+ *  @return The identifier, or zero if the pixel format cannot be identified.
+ *  @ingroup platform
+ */
+int _glfwPlatformGetPixelFormatID(_GLFWwindow* window);
+
 
 //========================================================================
 // Event API functions
@@ -676,9 +875,11 @@ void _glfwInputMouseClick(_GLFWwindow* window, int button, int action, int mods)
  *  of the client area of the window.
  *  @param[in] y The new y-coordinate of the cursor, relative to the top edge
  *  of the client area of the window.
+ *  @param[in] time The time, in the time base of @ref glfwGetTime, at which
+ *  the motion occurred.
  *  @ingroup event
  */
-void _glfwInputCursorMotion(_GLFWwindow* window, double x, double y);
+void _glfwInputCursorMotion(_GLFWwindow* window, double x, double y, double time);
 
 /*! @brief Notifies shared code of a cursor enter/leave event.
  *  @param[in] window The window that received the event.
@@ -692,6 +893,24 @@ void _glfwInputCursorEnter(_GLFWwindow* window, int entered);
  */
 void _glfwInputMonitorChange(void);
 
+/*! @brief Notifies shared code of a joystick connection or disconnection.
+ *  @param[in] joy The joystick that was connected or disconnected.
+ *  @param[in] event One of `GLFW_CONNECTED` or `GLFW_DISCONNECTED`.
+ *  @ingroup event
+ */
+void _glfwInputJoystickChange(int joy, int event);
+
+/*! @brief Notifies shared code of a joystick axis or button change.
+ *  @param[in] joy The joystick whose state changed.
+ *  @param[in] type One of `GLFW_JOYSTICK_AXIS` or `GLFW_JOYSTICK_BUTTON`.
+ *  @param[in] index The index of the axis or button that changed.
+ *  @param[in] value The new axis value or button state.
+ *  @param[in] time The time, in the time base of @ref glfwGetTime, at which
+ *  the change occurred.
+ *  @ingroup event
+ */
+void _glfwInputJoystickInput(int joy, int type, int index, float value, double time);
+
 /*! @brief Notifies shared code of an error.
  *  @param[in] error The error code most suitable for the error.
  *  @param[in] format The `printf` style format string of the error
@@ -736,6 +955,33 @@ void _glfwSplitBPP(int bpp, int* red, int* green, int* blue);
  */
 int _glfwStringInExtensionString(const char* string, const GLubyte* extensions);
 
+/*! @brief Builds an extension set from a space-separated extension string.
+ *  @param[out] set The set to initialize.
+ *  @param[in] string The extension string to parse.
+ *  @return `GL_TRUE` if successful, or `GL_FALSE` otherwise.
+ *  @ingroup utility
+ */
+GLboolean _glfwInitExtensionSet(_GLFWextensions* set, const char* string);
+
+/*! @brief Frees the storage of an extension set and clears it.
+ *  @param[in] set The set to free.
+ *  @ingroup utility
+ */
+void _glfwFreeExtensionSet(_GLFWextensions* set);
+
+/*! @brief Checks whether an extension set contains the specified extension.
+ *  @param[in] set The set to search.
+ *  @param[in] extension The extension to search for.
+ *  @return `GL_TRUE` if the extension was found, or `GL_FALSE` otherwise.
+ *  @ingroup utility
+ */
+GLboolean _glfwExtensionInSet(const _GLFWextensions* set, const char* extension);
+
+/*! @brief Frees all context function pointer caches.
+ *  @ingroup utility
+ */
+void _glfwFreeProcCaches(void);
+
 /*! @brief Chooses the framebuffer config that best matches the desired one.
  *  @param[in] desired The desired framebuffer config.
  *  @param[in] alternatives The framebuffer configs supported by the system.
@@ -28,6 +28,23 @@
 #include "internal.h"
 
 
+//////////////////////////////////////////////////////////////////////////
+//////                         GLFW event API                       //////
+//////////////////////////////////////////////////////////////////////////
+
+void _glfwInputJoystickChange(int joy, int event)
+{
+    if (_glfw.callbacks.joystick)
+        _glfw.callbacks.joystick(joy, event);
+}
+
+void _glfwInputJoystickInput(int joy, int type, int index, float value, double time)
+{
+    if (_glfw.callbacks.joystickInput)
+        _glfw.callbacks.joystickInput(joy, type, index, value, time);
+}
+
+
 //////////////////////////////////////////////////////////////////////////
 //////                        GLFW public API                       //////
 //////////////////////////////////////////////////////////////////////////
@@ -88,3 +105,42 @@ GLFWAPI const char* glfwGetJoystickName(int joy)
     return _glfwPlatformGetJoystickName(joy);
 }
 
+GLFWAPI GLFWjoystickfun glfwSetJoystickCallback(GLFWjoystickfun cbfun)
+{
+    _GLFW_REQUIRE_INIT_OR_RETURN(NULL);
+    _GLFW_SWAP_POINTERS(_glfw.callbacks.joystick, cbfun);
+    return cbfun;
+}
+
+GLFWAPI GLFWjoystickinputfun glfwSetJoystickInputCallback(GLFWjoystickinputfun cbfun)
+{
+    _GLFW_REQUIRE_INIT_OR_RETURN(NULL);
+    _GLFW_SWAP_POINTERS(_glfw.callbacks.joystickInput, cbfun);
+    return cbfun;
+}
+
+GLFWAPI void glfwSetJoystickSampling(int enabled)
+{
+    _GLFW_REQUIRE_INIT();
+    _glfwPlatformSetJoystickSampling(enabled);
+}
+
+GLFWAPI int glfwGetJoystickHistory(int joy, GLFWjoysticksample* samples, int capacity)
+{
+    _GLFW_REQUIRE_INIT_OR_RETURN(0);
+
+    if (joy < 0 || joy > GLFW_JOYSTICK_LAST)
+    {
+        _glfwInputError(GLFW_INVALID_ENUM, NULL);
+        return 0;
+    }
+
+    if (capacity < 0)
+    {
+        _glfwInputError(GLFW_INVALID_VALUE, NULL);
+        return 0;
+    }
+
+    return _glfwPlatformGetJoystickHistory(joy, samples, capacity);
+}
+
@@ -350,3 +350,46 @@ GLFWAPI const GLFWvidmode* glfwGetVideoMode(GLFWmonitor* handle)
     return &monitor->currentMode;
 }
 
+GLFWAPI void glfwGetVideoModeRefreshRational(GLFWmonitor* handle,
+                                             int* numerator, int* denominator)
+{
+    _GLFWmonitor* monitor = (_GLFWmonitor*) handle;
+    unsigned long num = 0, den = 1, a, b, t;
+
+    if (numerator)
+        *numerator = 0;
+    if (denominator)
+        *denominator = 1;
+
+    _GLFW_REQUIRE_INIT();
+
+    _glfwPlatformGetVideoModeRefreshRational(monitor, &num, &den);
+    if (!num || !den)
+        return;
+
+    // Reduce the fraction by its greatest common divisor
+    a = num;
+    b = den;
+    while (b)
+    {
+        t = a % b;
+        a = b;
+        b = t;
+    }
+
+    num /= a;
+    den /= a;
+
+    // Trade precision for range if the fraction still doesn't fit
+    while (num > INT_MAX || den > INT_MAX)
+    {
+        num = (num + 1) / 2;
+        den = (den + 1) / 2;
+    }
+
+    if (numerator)
+        *numerator = (int) num;
+    if (denominator)
+        *denominator = (int) den;
+}
+
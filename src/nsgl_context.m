@@ -44,6 +44,8 @@ int _glfwInitContextAPI(void)
         return GL_FALSE;
     }
 
+    pthread_mutex_init(&_glfw.nsgl.procLock, NULL);
+
     _glfw.nsgl.framework =
         CFBundleGetBundleWithIdentifier(CFSTR("com.apple.opengl"));
     if (_glfw.nsgl.framework == NULL)
@@ -60,6 +62,7 @@ int _glfwInitContextAPI(void)
 //
 void _glfwTerminateContextAPI(void)
 {
+    pthread_mutex_destroy(&_glfw.nsgl.procLock);
     pthread_key_delete(_glfw.nsgl.current);
 }
 
@@ -228,6 +231,17 @@ void _glfwDestroyContext(_GLFWwindow* window)
 //////                       GLFW platform API                      //////
 //////////////////////////////////////////////////////////////////////////
 
+int _glfwPlatformCreateOffscreenContext(_GLFWwindow* window,
+                                        const _GLFWctxconfig* ctxconfig,
+                                        const _GLFWfbconfig* fbconfig)
+{
+    // NSGL contexts are created along with the view of their window, and the
+    // only windowless drawable, NSOpenGLPixelBuffer, is deprecated
+    _glfwInputError(GLFW_API_UNAVAILABLE,
+                    "NSGL: Offscreen contexts are not yet supported");
+    return GL_FALSE;
+}
+
 void _glfwPlatformMakeContextCurrent(_GLFWwindow* window)
 {
     if (window)
@@ -238,6 +252,15 @@ void _glfwPlatformMakeContextCurrent(_GLFWwindow* window)
     pthread_setspecific(_glfw.nsgl.current, window);
 }
 
+int _glfwPlatformMakeContextCurrentOn(_GLFWwindow* window, _GLFWwindow* target)
+{
+    // An NSOpenGLContext draws to the single view set with setView:, and
+    // moving it to another view would detach it from its own window
+    _glfwInputError(GLFW_API_UNAVAILABLE,
+                    "NSGL: Binding a context to another window is not yet supported");
+    return GL_FALSE;
+}
+
 _GLFWwindow* _glfwPlatformGetCurrentContext(void)
 {
     return (_GLFWwindow*) pthread_getspecific(_glfw.nsgl.current);
@@ -249,12 +272,40 @@ void _glfwPlatformSwapBuffers(_GLFWwindow* window)
     [window->nsgl.context flushBuffer];
 }
 
-void _glfwPlatformSwapInterval(int interval)
+int _glfwPlatformSwapInterval(_GLFWwindow* window, int interval)
 {
-    _GLFWwindow* window = _glfwPlatformGetCurrentContext();
-
-    GLint sync = interval;
+    // NSOpenGL has no swaps that tear when late, so fall back to regular vsync
+    GLint sync = interval < 0 ? -interval : interval;
     [window->nsgl.context setValues:&sync forParameter:NSOpenGLCPSwapInterval];
+
+    // NSOpenGL only supports enabling or disabling vsync
+    return sync ? 1 : 0;
+}
+
+int _glfwPlatformSwapIntervalNeedsContext(_GLFWwindow* window)
+{
+    // The interval is a parameter of the context object itself
+    return GL_FALSE;
+}
+
+int _glfwPlatformGetSwapInterval(_GLFWwindow* window)
+{
+    // The swap interval cannot be queried
+    return window->appliedInterval;
+}
+
+int _glfwPlatformGetSyncValues(_GLFWwindow* window,
+                               int64_t* ust, int64_t* msc, int64_t* sbc)
+{
+    // CGL exposes no retrace or swap counters for a context, and display
+    // link timing is not tied to its buffer swaps
+    return GL_FALSE;
+}
+
+int _glfwPlatformWaitForMSC(_GLFWwindow* window, int64_t msc)
+{
+    // CGL has no way of waiting for a given retrace count
+    return GL_FALSE;
 }
 
 int _glfwPlatformExtensionSupported(const char* extension)
@@ -263,6 +314,14 @@ int _glfwPlatformExtensionSupported(const char* extension)
     return GL_FALSE;
 }
 
+const _GLFWfbconfig* _glfwPlatformGetFramebufferConfigs(int* count)
+{
+    // NSOpenGLPixelFormat only chooses a single matching format and has no way
+    // of enumerating the available ones
+    *count = 0;
+    return NULL;
+}
+
 GLFWglproc _glfwPlatformGetProcAddress(const char* procname)
 {
     CFStringRef symbolName = CFStringCreateWithCString(kCFAllocatorDefault,
@@ -277,6 +336,22 @@ GLFWglproc _glfwPlatformGetProcAddress(const char* procname)
     return symbol;
 }
 
+void _glfwPlatformLockProcCache(void)
+{
+    pthread_mutex_lock(&_glfw.nsgl.procLock);
+}
+
+void _glfwPlatformUnlockProcCache(void)
+{
+    pthread_mutex_unlock(&_glfw.nsgl.procLock);
+}
+
+int _glfwPlatformGetPixelFormatID(_GLFWwindow* window)
+{
+    // NSOpenGLPixelFormat objects have no identifier that can be compared
+    return 0;
+}
+
 
 //////////////////////////////////////////////////////////////////////////
 //////                        GLFW native API                       //////
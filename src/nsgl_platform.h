@@ -57,6 +57,8 @@ typedef struct _GLFWlibraryNSGL
 
     // TLS key for per-thread current context/window
     pthread_key_t   current;
+    // Lock for the context function pointer caches
+    pthread_mutex_t procLock;
 
 } _GLFWlibraryNSGL;
 
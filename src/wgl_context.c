@@ -56,6 +56,7 @@ static void initWGLExtensions(_GLFWwindow* window)
     window->wgl.EXT_create_context_es2_profile = GL_FALSE;
     window->wgl.ARB_create_context_robustness = GL_FALSE;
     window->wgl.EXT_swap_control = GL_FALSE;
+    window->wgl.EXT_swap_control_tear = GL_FALSE;
     window->wgl.ARB_pixel_format = GL_FALSE;
 
     window->wgl.GetExtensionsStringEXT = (PFNWGLGETEXTENSIONSSTRINGEXTPROC)
@@ -111,6 +112,12 @@ static void initWGLExtensions(_GLFWwindow* window)
             window->wgl.EXT_swap_control = GL_TRUE;
     }
 
+    if (window->wgl.EXT_swap_control &&
+        _glfwPlatformExtensionSupported("WGL_EXT_swap_control_tear"))
+    {
+        window->wgl.EXT_swap_control_tear = GL_TRUE;
+    }
+
     if (_glfwPlatformExtensionSupported("WGL_ARB_pixel_format"))
     {
         window->wgl.GetPixelFormatAttribivARB = (PFNWGLGETPIXELFORMATATTRIBIVARBPROC)
@@ -321,6 +328,7 @@ int _glfwInitContextAPI(void)
         return GL_FALSE;
     }
 
+    InitializeCriticalSection(&_glfw.wgl.procLock);
     _glfw.wgl.hasTLS = GL_TRUE;
 
     return GL_TRUE;
@@ -331,7 +339,10 @@ int _glfwInitContextAPI(void)
 void _glfwTerminateContextAPI(void)
 {
     if (_glfw.wgl.hasTLS)
+    {
+        DeleteCriticalSection(&_glfw.wgl.procLock);
         TlsFree(_glfw.wgl.current);
+    }
 
     if (_glfw.wgl.opengl32.instance)
         FreeLibrary(_glfw.wgl.opengl32.instance);
@@ -581,6 +592,17 @@ int _glfwAnalyzeContext(const _GLFWwindow* window,
 //////                       GLFW platform API                      //////
 //////////////////////////////////////////////////////////////////////////
 
+int _glfwPlatformCreateOffscreenContext(_GLFWwindow* window,
+                                        const _GLFWctxconfig* ctxconfig,
+                                        const _GLFWfbconfig* fbconfig)
+{
+    // A WGL context needs a device context with a pixel format, and without
+    // WGL_ARB_pbuffer the only source of one is a window
+    _glfwInputError(GLFW_API_UNAVAILABLE,
+                    "WGL: Offscreen contexts are not yet supported");
+    return GL_FALSE;
+}
+
 void _glfwPlatformMakeContextCurrent(_GLFWwindow* window)
 {
     if (window)
@@ -591,6 +613,16 @@ void _glfwPlatformMakeContextCurrent(_GLFWwindow* window)
     TlsSetValue(_glfw.wgl.current, window);
 }
 
+int _glfwPlatformMakeContextCurrentOn(_GLFWwindow* window, _GLFWwindow* target)
+{
+    // wglMakeCurrent binds a context to a single device context, and drawing
+    // to another window would need WGL_ARB_make_current_read, which is not
+    // loaded
+    _glfwInputError(GLFW_API_UNAVAILABLE,
+                    "WGL: Binding a context to another window is not yet supported");
+    return GL_FALSE;
+}
+
 _GLFWwindow* _glfwPlatformGetCurrentContext(void)
 {
     return TlsGetValue(_glfw.wgl.current);
@@ -601,21 +633,56 @@ void _glfwPlatformSwapBuffers(_GLFWwindow* window)
     SwapBuffers(window->wgl.dc);
 }
 
-void _glfwPlatformSwapInterval(int interval)
+int _glfwPlatformSwapInterval(_GLFWwindow* window, int interval)
 {
-    _GLFWwindow* window = _glfwPlatformGetCurrentContext();
-
 #if !defined(_GLFW_USE_DWM_SWAP_INTERVAL)
     if (_glfwIsCompositionEnabled() && interval)
     {
         // Don't enabled vsync when desktop compositing is enabled, as it leads
         // to frame jitter
-        return;
+        return window->appliedInterval;
     }
 #endif
 
+    // Negative intervals request swaps that tear when late, which only
+    // WGL_EXT_swap_control_tear supports, so fall back to regular vsync
+    if (interval < 0 && !window->wgl.EXT_swap_control_tear)
+        interval = -interval;
+
     if (window->wgl.EXT_swap_control)
-        window->wgl.SwapIntervalEXT(interval);
+    {
+        if (window->wgl.SwapIntervalEXT(interval))
+            return interval;
+    }
+
+    return window->appliedInterval;
+}
+
+int _glfwPlatformSwapIntervalNeedsContext(_GLFWwindow* window)
+{
+    // wglSwapIntervalEXT applies to the window of the current context
+    return GL_TRUE;
+}
+
+int _glfwPlatformGetSwapInterval(_GLFWwindow* window)
+{
+    // The swap interval cannot be queried
+    return window->appliedInterval;
+}
+
+int _glfwPlatformGetSyncValues(_GLFWwindow* window,
+                               int64_t* ust, int64_t* msc, int64_t* sbc)
+{
+    // WGL_OML_sync_control is not loaded, as Windows drivers rarely
+    // expose it, and there is no other source of retrace and swap counters
+    return GL_FALSE;
+}
+
+int _glfwPlatformWaitForMSC(_GLFWwindow* window, int64_t msc)
+{
+    // Waiting for a retrace count needs WGL_OML_sync_control, which is
+    // not loaded
+    return GL_FALSE;
 }
 
 int _glfwPlatformExtensionSupported(const char* extension)
@@ -647,6 +714,14 @@ int _glfwPlatformExtensionSupported(const char* extension)
     return GL_FALSE;
 }
 
+const _GLFWfbconfig* _glfwPlatformGetFramebufferConfigs(int* count)
+{
+    // Pixel formats can only be enumerated for a device context, which does
+    // not exist before a window has been created, so there is nothing to cache
+    *count = 0;
+    return NULL;
+}
+
 GLFWglproc _glfwPlatformGetProcAddress(const char* procname)
 {
     const GLFWglproc proc = (GLFWglproc) wglGetProcAddress(procname);
@@ -656,6 +731,21 @@ GLFWglproc _glfwPlatformGetProcAddress(const char* procname)
     return (GLFWglproc) GetProcAddress(_glfw.wgl.opengl32.instance, procname);
 }
 
+void _glfwPlatformLockProcCache(void)
+{
+    EnterCriticalSection(&_glfw.wgl.procLock);
+}
+
+void _glfwPlatformUnlockProcCache(void)
+{
+    LeaveCriticalSection(&_glfw.wgl.procLock);
+}
+
+int _glfwPlatformGetPixelFormatID(_GLFWwindow* window)
+{
+    return GetPixelFormat(window->wgl.dc);
+}
+
 
 //////////////////////////////////////////////////////////////////////////
 //////                        GLFW native API                       //////
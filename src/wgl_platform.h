@@ -59,6 +59,7 @@ typedef struct _GLFWcontextWGL
     PFNWGLGETEXTENSIONSSTRINGARBPROC    GetExtensionsStringARB;
     PFNWGLCREATECONTEXTATTRIBSARBPROC   CreateContextAttribsARB;
     GLboolean                           EXT_swap_control;
+    GLboolean                           EXT_swap_control_tear;
     GLboolean                           ARB_multisample;
     GLboolean                           ARB_framebuffer_sRGB;
     GLboolean                           ARB_pixel_format;
@@ -76,6 +77,8 @@ typedef struct _GLFWlibraryWGL
 {
     GLboolean       hasTLS;
     DWORD           current;
+    // Lock for the context function pointer caches, created with the TLS
+    CRITICAL_SECTION procLock;
 
     // opengl32.dll
     struct {
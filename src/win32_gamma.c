@@ -54,6 +54,12 @@ void _glfwPlatformGetGammaRamp(_GLFWmonitor* monitor, GLFWgammaramp* ramp)
     memcpy(ramp->blue,  values + 512, 256 * sizeof(unsigned short));
 }
 
+int _glfwPlatformGetGammaRampSize(_GLFWmonitor* monitor)
+{
+    // GetDeviceGammaRamp and SetDeviceGammaRamp only support this size
+    return 256;
+}
+
 void _glfwPlatformSetGammaRamp(_GLFWmonitor* monitor, const GLFWgammaramp* ramp)
 {
     HDC dc;
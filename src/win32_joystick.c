@@ -175,3 +175,17 @@ const char* _glfwPlatformGetJoystickName(int joy)
     return _glfw.win32.joystick[joy].name;
 }
 
+void _glfwPlatformSetJoystickSampling(int enabled)
+{
+    if (enabled)
+    {
+        _glfwInputError(GLFW_PLATFORM_ERROR,
+                        "Win32: Background joystick sampling is not supported");
+    }
+}
+
+int _glfwPlatformGetJoystickHistory(int joy, GLFWjoysticksample* samples, int capacity)
+{
+    return 0;
+}
+
@@ -286,6 +286,25 @@ void _glfwPlatformGetVideoMode(_GLFWmonitor* monitor, GLFWvidmode* mode)
                   &mode->blueBits);
 }
 
+void _glfwPlatformGetVideoModeRefreshRational(_GLFWmonitor* monitor,
+                                              unsigned long* numerator,
+                                              unsigned long* denominator)
+{
+    DEVMODEW dm;
+
+    ZeroMemory(&dm, sizeof(DEVMODEW));
+    dm.dmSize = sizeof(DEVMODEW);
+
+    EnumDisplaySettingsW(monitor->win32.name, ENUM_CURRENT_SETTINGS, &dm);
+
+    // Values of zero and one both mean the hardware default rate
+    if (dm.dmDisplayFrequency > 1)
+    {
+        *numerator = dm.dmDisplayFrequency;
+        *denominator = 1;
+    }
+}
+
 
 //////////////////////////////////////////////////////////////////////////
 //////                        GLFW native API                       //////
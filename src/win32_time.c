@@ -84,3 +84,8 @@ void _glfwPlatformSetTime(double time)
         (unsigned __int64) (time / _glfw.win32.timer.resolution);
 }
 
+void _glfwPlatformSleep(double seconds)
+{
+    Sleep((DWORD) (seconds * 1000.0));
+}
+
@@ -636,7 +636,7 @@ static LRESULT CALLBACK windowProc(HWND hWnd, UINT uMsg,
                 window->win32.oldCursorY = newCursorY;
                 window->win32.cursorCentered = GL_FALSE;
 
-                _glfwInputCursorMotion(window, x, y);
+                _glfwInputCursorMotion(window, x, y, _glfwPlatformGetTime());
             }
 
             if (!window->win32.cursorInside)
@@ -741,7 +741,8 @@ static LRESULT CALLBACK windowProc(HWND hWnd, UINT uMsg,
             {
                 _GLFWwindow* previous = _glfwPlatformGetCurrentContext();
                 _glfwPlatformMakeContextCurrent(window);
-                _glfwPlatformSwapInterval(0);
+                window->swapInterval = window->appliedInterval =
+                    _glfwPlatformSwapInterval(window, 0);
                 _glfwPlatformMakeContextCurrent(previous);
             }
 
@@ -760,7 +761,7 @@ static LRESULT CALLBACK windowProc(HWND hWnd, UINT uMsg,
 
             // Move the mouse to the position of the drop
             DragQueryPoint(hDrop, &pt);
-            _glfwInputCursorMotion(window, pt.x, pt.y);
+            _glfwInputCursorMotion(window, pt.x, pt.y, _glfwPlatformGetTime());
 
             for (i = 0;  i < count;  i++)
             {
@@ -39,6 +39,42 @@ static int Max(int a, int b)
     return (a > b) ? a : b;
 }
 
+// Sets up the desired framebuffer config from the current hints
+//
+static void initFBConfig(_GLFWfbconfig* fbconfig)
+{
+    fbconfig->redBits        = Max(_glfw.hints.redBits, 0);
+    fbconfig->greenBits      = Max(_glfw.hints.greenBits, 0);
+    fbconfig->blueBits       = Max(_glfw.hints.blueBits, 0);
+    fbconfig->alphaBits      = Max(_glfw.hints.alphaBits, 0);
+    fbconfig->depthBits      = Max(_glfw.hints.depthBits, 0);
+    fbconfig->stencilBits    = Max(_glfw.hints.stencilBits, 0);
+    fbconfig->accumRedBits   = Max(_glfw.hints.accumRedBits, 0);
+    fbconfig->accumGreenBits = Max(_glfw.hints.accumGreenBits, 0);
+    fbconfig->accumBlueBits  = Max(_glfw.hints.accumBlueBits, 0);
+    fbconfig->accumAlphaBits = Max(_glfw.hints.accumAlphaBits, 0);
+    fbconfig->auxBuffers     = Max(_glfw.hints.auxBuffers, 0);
+    fbconfig->stereo         = _glfw.hints.stereo ? GL_TRUE : GL_FALSE;
+    fbconfig->samples        = Max(_glfw.hints.samples, 0);
+    fbconfig->sRGB           = _glfw.hints.sRGB ? GL_TRUE : GL_FALSE;
+}
+
+// Sets up the desired context config from the current hints
+//
+static void initCtxConfig(_GLFWctxconfig* ctxconfig, _GLFWwindow* share)
+{
+    ctxconfig->api           = _glfw.hints.api;
+    ctxconfig->major         = _glfw.hints.major;
+    ctxconfig->minor         = _glfw.hints.minor;
+    ctxconfig->forward       = _glfw.hints.forward ? GL_TRUE : GL_FALSE;
+    ctxconfig->debug         = _glfw.hints.debug ? GL_TRUE : GL_FALSE;
+    ctxconfig->profile       = _glfw.hints.profile;
+    ctxconfig->robustness    = _glfw.hints.robustness;
+    ctxconfig->noerror       = _glfw.hints.noerror ? GL_TRUE : GL_FALSE;
+    ctxconfig->release       = _glfw.hints.release;
+    ctxconfig->share         = share;
+}
+
 
 //////////////////////////////////////////////////////////////////////////
 //////                         GLFW event API                       //////
@@ -147,6 +183,7 @@ GLFWAPI GLFWwindow* glfwCreateWindow(int width, int height,
     _GLFWwndconfig wndconfig;
     _GLFWwindow* window;
     _GLFWwindow* previous;
+    _GLFWwindow* previousTarget = NULL;
 
     _GLFW_REQUIRE_INIT_OR_RETURN(NULL);
 
@@ -157,20 +194,7 @@ GLFWAPI GLFWwindow* glfwCreateWindow(int width, int height,
     }
 
     // Set up desired framebuffer config
-    fbconfig.redBits        = Max(_glfw.hints.redBits, 0);
-    fbconfig.greenBits      = Max(_glfw.hints.greenBits, 0);
-    fbconfig.blueBits       = Max(_glfw.hints.blueBits, 0);
-    fbconfig.alphaBits      = Max(_glfw.hints.alphaBits, 0);
-    fbconfig.depthBits      = Max(_glfw.hints.depthBits, 0);
-    fbconfig.stencilBits    = Max(_glfw.hints.stencilBits, 0);
-    fbconfig.accumRedBits   = Max(_glfw.hints.accumRedBits, 0);
-    fbconfig.accumGreenBits = Max(_glfw.hints.accumGreenBits, 0);
-    fbconfig.accumBlueBits  = Max(_glfw.hints.accumBlueBits, 0);
-    fbconfig.accumAlphaBits = Max(_glfw.hints.accumAlphaBits, 0);
-    fbconfig.auxBuffers     = Max(_glfw.hints.auxBuffers, 0);
-    fbconfig.stereo         = _glfw.hints.stereo ? GL_TRUE : GL_FALSE;
-    fbconfig.samples        = Max(_glfw.hints.samples, 0);
-    fbconfig.sRGB           = _glfw.hints.sRGB ? GL_TRUE : GL_FALSE;
+    initFBConfig(&fbconfig);
 
     // Set up desired window config
     wndconfig.width         = width;
@@ -179,17 +203,11 @@ GLFWAPI GLFWwindow* glfwCreateWindow(int width, int height,
     wndconfig.resizable     = _glfw.hints.resizable ? GL_TRUE : GL_FALSE;
     wndconfig.visible       = _glfw.hints.visible ? GL_TRUE : GL_FALSE;
     wndconfig.decorated     = _glfw.hints.decorated ? GL_TRUE : GL_FALSE;
+    wndconfig.borderless    = _glfw.hints.borderless ? GL_TRUE : GL_FALSE;
     wndconfig.monitor       = (_GLFWmonitor*) monitor;
 
     // Set up desired context config
-    ctxconfig.api           = _glfw.hints.api;
-    ctxconfig.major         = _glfw.hints.major;
-    ctxconfig.minor         = _glfw.hints.minor;
-    ctxconfig.forward       = _glfw.hints.forward ? GL_TRUE : GL_FALSE;
-    ctxconfig.debug         = _glfw.hints.debug ? GL_TRUE : GL_FALSE;
-    ctxconfig.profile       = _glfw.hints.profile;
-    ctxconfig.robustness    = _glfw.hints.robustness;
-    ctxconfig.share         = (_GLFWwindow*) share;
+    initCtxConfig(&ctxconfig, (_GLFWwindow*) share);
 
     // Check the OpenGL bits of the window config
     if (!_glfwIsValidContextConfig(&ctxconfig))
@@ -211,21 +229,37 @@ GLFWAPI GLFWwindow* glfwCreateWindow(int width, int height,
         window->videoMode.greenBits   = Max(_glfw.hints.greenBits, 0);
         window->videoMode.blueBits    = Max(_glfw.hints.blueBits, 0);
         window->videoMode.refreshRate = Max(_glfw.hints.refreshRate, 0);
+
+        if (wndconfig.borderless)
+        {
+            // Borderless full screen windows cover the monitor at its current
+            // video mode instead of switching modes
+            _glfwPlatformGetVideoMode(wndconfig.monitor, &window->videoMode);
+            wndconfig.width  = window->videoMode.width;
+            wndconfig.height = window->videoMode.height;
+        }
     }
+    else
+        wndconfig.borderless = GL_FALSE;
 
     window->monitor    = wndconfig.monitor;
     window->resizable  = wndconfig.resizable;
     window->decorated  = wndconfig.decorated;
+    window->borderless = wndconfig.borderless;
     window->cursorMode = GLFW_CURSOR_NORMAL;
+    window->cursorPrediction = GLFW_PREDICTION_LINEAR;
 
     // Save the currently current context so it can be restored later
     previous = (_GLFWwindow*) glfwGetCurrentContext();
+    if (previous)
+        previousTarget = previous->context.target;
 
     // Open the actual window and create its context
     if (!_glfwPlatformCreateWindow(window, &wndconfig, &ctxconfig, &fbconfig))
     {
         glfwDestroyWindow((GLFWwindow*) window);
-        glfwMakeContextCurrent((GLFWwindow*) previous);
+        glfwMakeContextCurrentOn((GLFWwindow*) previous,
+                                 (GLFWwindow*) previousTarget);
         return NULL;
     }
 
@@ -235,7 +269,8 @@ GLFWAPI GLFWwindow* glfwCreateWindow(int width, int height,
     if (!_glfwRefreshContextAttribs(&ctxconfig))
     {
         glfwDestroyWindow((GLFWwindow*) window);
-        glfwMakeContextCurrent((GLFWwindow*) previous);
+        glfwMakeContextCurrentOn((GLFWwindow*) previous,
+                                 (GLFWwindow*) previousTarget);
         return NULL;
     }
 
@@ -243,17 +278,23 @@ GLFWAPI GLFWwindow* glfwCreateWindow(int width, int height,
     if (!_glfwIsValidContext(&ctxconfig))
     {
         glfwDestroyWindow((GLFWwindow*) window);
-        glfwMakeContextCurrent((GLFWwindow*) previous);
+        glfwMakeContextCurrentOn((GLFWwindow*) previous,
+                                 (GLFWwindow*) previousTarget);
         return NULL;
     }
 
+    // Read back the swap interval the window was created with, where possible
+    window->swapInterval = window->appliedInterval =
+        _glfwPlatformGetSwapInterval(window);
+
     // Clearing the front buffer to black to avoid garbage pixels left over
     // from previous uses of our bit of VRAM
     glClear(GL_COLOR_BUFFER_BIT);
     _glfwPlatformSwapBuffers(window);
 
     // Restore the previously current context (or NULL)
-    glfwMakeContextCurrent((GLFWwindow*) previous);
+    glfwMakeContextCurrentOn((GLFWwindow*) previous,
+                             (GLFWwindow*) previousTarget);
 
     if (wndconfig.monitor == NULL && wndconfig.visible)
         glfwShowWindow((GLFWwindow*) window);
@@ -261,6 +302,70 @@ GLFWAPI GLFWwindow* glfwCreateWindow(int width, int height,
     return (GLFWwindow*) window;
 }
 
+GLFWAPI GLFWwindow* glfwCreateOffscreenContext(GLFWwindow* share)
+{
+    _GLFWfbconfig fbconfig;
+    _GLFWctxconfig ctxconfig;
+    _GLFWwindow* window;
+    _GLFWwindow* previous;
+    _GLFWwindow* previousTarget = NULL;
+
+    _GLFW_REQUIRE_INIT_OR_RETURN(NULL);
+
+    initFBConfig(&fbconfig);
+    initCtxConfig(&ctxconfig, (_GLFWwindow*) share);
+
+    // Check the OpenGL bits of the window config
+    if (!_glfwIsValidContextConfig(&ctxconfig))
+        return NULL;
+
+    window = calloc(1, sizeof(_GLFWwindow));
+    window->next = _glfw.offscreenListHead;
+    _glfw.offscreenListHead = window;
+
+    window->offscreen  = GL_TRUE;
+    window->cursorMode = GLFW_CURSOR_NORMAL;
+
+    // Save the currently current context so it can be restored later
+    previous = (_GLFWwindow*) glfwGetCurrentContext();
+    if (previous)
+        previousTarget = previous->context.target;
+
+    if (!_glfwPlatformCreateOffscreenContext(window, &ctxconfig, &fbconfig))
+    {
+        glfwDestroyWindow((GLFWwindow*) window);
+        glfwMakeContextCurrentOn((GLFWwindow*) previous,
+                                 (GLFWwindow*) previousTarget);
+        return NULL;
+    }
+
+    glfwMakeContextCurrent((GLFWwindow*) window);
+
+    // Retrieve the actual (as opposed to requested) context attributes
+    if (!_glfwRefreshContextAttribs(&ctxconfig))
+    {
+        glfwDestroyWindow((GLFWwindow*) window);
+        glfwMakeContextCurrentOn((GLFWwindow*) previous,
+                                 (GLFWwindow*) previousTarget);
+        return NULL;
+    }
+
+    // Verify the context against the requested parameters
+    if (!_glfwIsValidContext(&ctxconfig))
+    {
+        glfwDestroyWindow((GLFWwindow*) window);
+        glfwMakeContextCurrentOn((GLFWwindow*) previous,
+                                 (GLFWwindow*) previousTarget);
+        return NULL;
+    }
+
+    // Restore the previously current context (or NULL)
+    glfwMakeContextCurrentOn((GLFWwindow*) previous,
+                             (GLFWwindow*) previousTarget);
+
+    return (GLFWwindow*) window;
+}
+
 void glfwDefaultWindowHints(void)
 {
     _GLFW_REQUIRE_INIT();
@@ -337,6 +442,9 @@ GLFWAPI void glfwWindowHint(int target, int hint)
         case GLFW_DECORATED:
             _glfw.hints.decorated = hint;
             break;
+        case GLFW_FULLSCREEN_BORDERLESS:
+            _glfw.hints.borderless = hint;
+            break;
         case GLFW_VISIBLE:
             _glfw.hints.visible = hint;
             break;
@@ -367,6 +475,12 @@ GLFWAPI void glfwWindowHint(int target, int hint)
         case GLFW_OPENGL_PROFILE:
             _glfw.hints.profile = hint;
             break;
+        case GLFW_CONTEXT_NO_ERROR:
+            _glfw.hints.noerror = hint;
+            break;
+        case GLFW_CONTEXT_RELEASE_BEHAVIOR:
+            _glfw.hints.release = hint;
+            break;
         default:
             _glfwInputError(GLFW_INVALID_ENUM, NULL);
             break;
@@ -376,6 +490,7 @@ GLFWAPI void glfwWindowHint(int target, int hint)
 GLFWAPI void glfwDestroyWindow(GLFWwindow* handle)
 {
     _GLFWwindow* window = (_GLFWwindow*) handle;
+    _GLFWwindow* current;
 
     _GLFW_REQUIRE_INIT();
 
@@ -387,8 +502,9 @@ GLFWAPI void glfwDestroyWindow(GLFWwindow* handle)
     memset(&window->callbacks, 0, sizeof(window->callbacks));
 
     // The window's context must not be current on another thread when the
-    // window is destroyed
-    if (window == _glfwPlatformGetCurrentContext())
+    // window is destroyed, and neither may another context be bound to it
+    current = _glfwPlatformGetCurrentContext();
+    if (current && (current == window || current->context.target == window))
         _glfwPlatformMakeContextCurrent(NULL);
 
     // Clear the focused window pointer if this is the focused window
@@ -396,10 +512,13 @@ GLFWAPI void glfwDestroyWindow(GLFWwindow* handle)
         _glfw.focusedWindow = NULL;
 
     _glfwPlatformDestroyWindow(window);
+    _glfwFreeExtensionSet(&window->context.extensions);
 
     // Unlink window from global linked list
     {
         _GLFWwindow** prev = &_glfw.windowListHead;
+        if (window->offscreen)
+            prev = &_glfw.offscreenListHead;
 
         while (*prev != window)
             prev = &((*prev)->next);
@@ -472,6 +591,10 @@ GLFWAPI void glfwSetWindowSize(GLFWwindow* handle, int width, int height)
 
     if (window->monitor)
     {
+        // Borderless full screen windows always cover their monitor
+        if (window->borderless)
+            return;
+
         window->videoMode.width  = width;
         window->videoMode.height = height;
     }
@@ -552,6 +675,10 @@ GLFWAPI int glfwGetWindowAttrib(GLFWwindow* handle, int attrib)
             return window->resizable;
         case GLFW_DECORATED:
             return window->decorated;
+        case GLFW_FULLSCREEN_BORDERLESS:
+            return window->borderless;
+        case GLFW_SWAP_INTERVAL:
+            return window->swapInterval;
         case GLFW_VISIBLE:
             return window->visible;
         case GLFW_CLIENT_API:
@@ -570,6 +697,10 @@ GLFWAPI int glfwGetWindowAttrib(GLFWwindow* handle, int attrib)
             return window->context.debug;
         case GLFW_OPENGL_PROFILE:
             return window->context.profile;
+        case GLFW_CONTEXT_NO_ERROR:
+            return window->context.noerror;
+        case GLFW_CONTEXT_RELEASE_BEHAVIOR:
+            return window->context.release;
     }
 
     _glfwInputError(GLFW_INVALID_ENUM, NULL);
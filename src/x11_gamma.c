@@ -30,6 +30,53 @@
 #include <string.h>
 
 
+// Returns the native gamma ramp size of the CRTC of the specified monitor
+//
+static int getGammaSize(_GLFWmonitor* monitor)
+{
+    if (!monitor->x11.gammaSize)
+    {
+        monitor->x11.gammaSize =
+            XRRGetCrtcGammaSize(_glfw.x11.display, _glfwGetMonitorCrtc(monitor));
+    }
+
+    return monitor->x11.gammaSize;
+}
+
+// Linearly resamples a gamma channel to the specified number of entries
+//
+static void resampleChannel(unsigned short* target, int targetSize,
+                            const unsigned short* source, int sourceSize)
+{
+    int i;
+    double scale = 0.0;
+
+    if (targetSize == sourceSize)
+    {
+        memcpy(target, source, targetSize * sizeof(unsigned short));
+        return;
+    }
+
+    if (targetSize > 1)
+        scale = (double) (sourceSize - 1) / (targetSize - 1);
+
+    for (i = 0;  i < targetSize;  i++)
+    {
+        const double position = targetSize > 1 ? i * scale : sourceSize - 1;
+        const int index = (int) position;
+        const double t = position - index;
+
+        if (index + 1 < sourceSize)
+        {
+            target[i] = (unsigned short) (source[index] * (1.0 - t) +
+                                          source[index + 1] * t + 0.5);
+        }
+        else
+            target[i] = source[sourceSize - 1];
+    }
+}
+
+
 //////////////////////////////////////////////////////////////////////////
 //////                       GLFW internal API                      //////
 //////////////////////////////////////////////////////////////////////////
@@ -66,10 +113,9 @@ void _glfwPlatformGetGammaRamp(_GLFWmonitor* monitor, GLFWgammaramp* ramp)
 {
     if (_glfw.x11.randr.available && !_glfw.x11.randr.gammaBroken)
     {
-        const size_t size = XRRGetCrtcGammaSize(_glfw.x11.display,
-                                                monitor->x11.crtc);
+        const size_t size = getGammaSize(monitor);
         XRRCrtcGamma* gamma = XRRGetCrtcGamma(_glfw.x11.display,
-                                              monitor->x11.crtc);
+                                              _glfwGetMonitorCrtc(monitor));
 
         _glfwAllocGammaArrays(ramp, size);
 
@@ -92,17 +138,38 @@ void _glfwPlatformGetGammaRamp(_GLFWmonitor* monitor, GLFWgammaramp* ramp)
     }
 }
 
+int _glfwPlatformGetGammaRampSize(_GLFWmonitor* monitor)
+{
+    if (_glfw.x11.randr.available && !_glfw.x11.randr.gammaBroken)
+        return getGammaSize(monitor);
+    else if (_glfw.x11.vidmode.available)
+    {
+        int size;
+        XF86VidModeGetGammaRampSize(_glfw.x11.display, _glfw.x11.screen, &size);
+        return size;
+    }
+
+    return 0;
+}
+
 void _glfwPlatformSetGammaRamp(_GLFWmonitor* monitor, const GLFWgammaramp* ramp)
 {
     if (_glfw.x11.randr.available && !_glfw.x11.randr.gammaBroken)
     {
-        XRRCrtcGamma* gamma = XRRAllocGamma(ramp->size);
+        const int size = getGammaSize(monitor);
+        XRRCrtcGamma* gamma;
+
+        if (!size || !ramp->size)
+            return;
+
+        gamma = XRRAllocGamma(size);
 
-        memcpy(gamma->red, ramp->red, ramp->size * sizeof(unsigned short));
-        memcpy(gamma->green, ramp->green, ramp->size * sizeof(unsigned short));
-        memcpy(gamma->blue, ramp->blue, ramp->size * sizeof(unsigned short));
+        // The server rejects ramps of any other size than that of the CRTC
+        resampleChannel(gamma->red, size, ramp->red, ramp->size);
+        resampleChannel(gamma->green, size, ramp->green, ramp->size);
+        resampleChannel(gamma->blue, size, ramp->blue, ramp->size);
 
-        XRRSetCrtcGamma(_glfw.x11.display, monitor->x11.crtc, gamma);
+        XRRSetCrtcGamma(_glfw.x11.display, _glfwGetMonitorCrtc(monitor), gamma);
         XRRFreeGamma(gamma);
     }
     else if (_glfw.x11.vidmode.available)
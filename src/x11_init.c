@@ -228,10 +228,10 @@ static void updateKeyCodeLUT(void)
     // Use XKB to determine physical key locations independently of the current
     // keyboard layout
 
-    // Get keyboard description
-    descr = XkbGetKeyboard(_glfw.x11.display,
-                            XkbAllComponentsMask,
-                            XkbUseCoreKbd);
+    // Get only the key names of the keyboard description, as fetching all
+    // components is slow
+    descr = XkbGetMap(_glfw.x11.display, 0, XkbUseCoreKbd);
+    XkbGetNames(_glfw.x11.display, XkbKeyNamesMask, descr);
 
     // Find the X11 key code -> GLFW key code mapping
     for (keyCode = descr->min_key_code; keyCode <= descr->max_key_code; ++keyCode)
@@ -302,6 +302,7 @@ static void updateKeyCodeLUT(void)
     }
 
     // Free the keyboard description
+    XkbFreeNames(descr, XkbKeyNamesMask, True);
     XkbFreeKeyboard(descr, 0, True);
 
     // Translate the un-translated key codes using traditional X11 KeySym
@@ -317,18 +318,14 @@ static void updateKeyCodeLUT(void)
 //
 static Atom getSupportedAtom(Atom* supportedAtoms,
                              unsigned long atomCount,
-                             const char* atomName)
+                             Atom atom)
 {
-    Atom atom = XInternAtom(_glfw.x11.display, atomName, True);
-    if (atom != None)
-    {
-        unsigned long i;
+    unsigned long i;
 
-        for (i = 0;  i < atomCount;  i++)
-        {
-            if (supportedAtoms[i] == atom)
-                return atom;
-        }
+    for (i = 0;  i < atomCount;  i++)
+    {
+        if (supportedAtoms[i] == atom)
+            return atom;
     }
 
     return None;
@@ -338,20 +335,35 @@ static Atom getSupportedAtom(Atom* supportedAtoms,
 //
 static void detectEWMH(void)
 {
+    int i;
     Window* windowFromRoot = NULL;
     Window* windowFromChild = NULL;
 
-    // First we need a couple of atoms, which should already be there
-    Atom supportingWmCheck =
-        XInternAtom(_glfw.x11.display, "_NET_SUPPORTING_WM_CHECK", True);
-    Atom wmSupported =
-        XInternAtom(_glfw.x11.display, "_NET_SUPPORTED", True);
-    if (supportingWmCheck == None || wmSupported == None)
-        return;
+    // The EWMH atoms were interned along with all others, but may only be
+    // used if the window manager reports supporting them
+    Atom* ewmhAtoms[] =
+    {
+        &_glfw.x11.NET_WM_STATE,
+        &_glfw.x11.NET_WM_STATE_FULLSCREEN,
+        &_glfw.x11.NET_WM_NAME,
+        &_glfw.x11.NET_WM_ICON_NAME,
+        &_glfw.x11.NET_WM_PID,
+        &_glfw.x11.NET_WM_PING,
+        &_glfw.x11.NET_ACTIVE_WINDOW,
+        &_glfw.x11.NET_WM_BYPASS_COMPOSITOR
+    };
+    const int ewmhAtomCount = sizeof(ewmhAtoms) / sizeof(ewmhAtoms[0]);
+    Atom interned[sizeof(ewmhAtoms) / sizeof(ewmhAtoms[0])];
+
+    for (i = 0;  i < ewmhAtomCount;  i++)
+    {
+        interned[i] = *ewmhAtoms[i];
+        *ewmhAtoms[i] = None;
+    }
 
     // Then we look for the _NET_SUPPORTING_WM_CHECK property of the root window
     if (_glfwGetWindowProperty(_glfw.x11.root,
-                               supportingWmCheck,
+                               _glfw.x11.NET_SUPPORTING_WM_CHECK,
                                XA_WINDOW,
                                (unsigned char**) &windowFromRoot) != 1)
     {
@@ -365,7 +377,7 @@ static void detectEWMH(void)
     // It should be the ID of a child window (of the root)
     // Then we look for the same property on the child window
     if (_glfwGetWindowProperty(*windowFromRoot,
-                               supportingWmCheck,
+                               _glfw.x11.NET_SUPPORTING_WM_CHECK,
                                XA_WINDOW,
                                (unsigned char**) &windowFromChild) != 1)
     {
@@ -396,62 +408,242 @@ static void detectEWMH(void)
     // Now we need to check the _NET_SUPPORTED property of the root window
     // It should be a list of supported WM protocol and state atoms
     atomCount = _glfwGetWindowProperty(_glfw.x11.root,
-                                       wmSupported,
+                                       _glfw.x11.NET_SUPPORTED,
                                        XA_ATOM,
                                        (unsigned char**) &supportedAtoms);
 
     // See which of the atoms we support that are supported by the WM
-    _glfw.x11.NET_WM_STATE =
-        getSupportedAtom(supportedAtoms, atomCount, "_NET_WM_STATE");
-    _glfw.x11.NET_WM_STATE_FULLSCREEN =
-        getSupportedAtom(supportedAtoms, atomCount, "_NET_WM_STATE_FULLSCREEN");
-    _glfw.x11.NET_WM_NAME =
-        getSupportedAtom(supportedAtoms, atomCount, "_NET_WM_NAME");
-    _glfw.x11.NET_WM_ICON_NAME =
-        getSupportedAtom(supportedAtoms, atomCount, "_NET_WM_ICON_NAME");
-    _glfw.x11.NET_WM_PID =
-        getSupportedAtom(supportedAtoms, atomCount, "_NET_WM_PID");
-    _glfw.x11.NET_WM_PING =
-        getSupportedAtom(supportedAtoms, atomCount, "_NET_WM_PING");
-    _glfw.x11.NET_ACTIVE_WINDOW =
-        getSupportedAtom(supportedAtoms, atomCount, "_NET_ACTIVE_WINDOW");
-    _glfw.x11.NET_WM_BYPASS_COMPOSITOR =
-        getSupportedAtom(supportedAtoms, atomCount, "_NET_WM_BYPASS_COMPOSITOR");
+    for (i = 0;  i < ewmhAtomCount;  i++)
+        *ewmhAtoms[i] = getSupportedAtom(supportedAtoms, atomCount, interned[i]);
 
     XFree(supportedAtoms);
 
     _glfw.x11.hasEWMH = GL_TRUE;
 }
 
+// Find or create all atoms used by GLFW in a single round trip
+//
+static void internAtoms(void)
+{
+    int i;
+    const struct
+    {
+        const char* name;
+        Atom* atom;
+    } atoms[] =
+    {
+        // Window manager atoms
+        { "WM_PROTOCOLS", &_glfw.x11.WM_PROTOCOLS },
+        { "WM_STATE", &_glfw.x11.WM_STATE },
+        { "WM_DELETE_WINDOW", &_glfw.x11.WM_DELETE_WINDOW },
+        { "_MOTIF_WM_HINTS", &_glfw.x11.MOTIF_WM_HINTS },
+
+        // EWMH atoms, which are filtered by detectEWMH
+        { "_NET_SUPPORTED", &_glfw.x11.NET_SUPPORTED },
+        { "_NET_SUPPORTING_WM_CHECK", &_glfw.x11.NET_SUPPORTING_WM_CHECK },
+        { "_NET_WM_STATE", &_glfw.x11.NET_WM_STATE },
+        { "_NET_WM_STATE_FULLSCREEN", &_glfw.x11.NET_WM_STATE_FULLSCREEN },
+        { "_NET_WM_NAME", &_glfw.x11.NET_WM_NAME },
+        { "_NET_WM_ICON_NAME", &_glfw.x11.NET_WM_ICON_NAME },
+        { "_NET_WM_PID", &_glfw.x11.NET_WM_PID },
+        { "_NET_WM_PING", &_glfw.x11.NET_WM_PING },
+        { "_NET_ACTIVE_WINDOW", &_glfw.x11.NET_ACTIVE_WINDOW },
+        { "_NET_WM_BYPASS_COMPOSITOR", &_glfw.x11.NET_WM_BYPASS_COMPOSITOR },
+
+        // String format atoms
+        { "NULL", &_glfw.x11._NULL },
+        { "UTF8_STRING", &_glfw.x11.UTF8_STRING },
+        { "COMPOUND_STRING", &_glfw.x11.COMPOUND_STRING },
+        { "ATOM_PAIR", &_glfw.x11.ATOM_PAIR },
+
+        // Selection property atom
+        { "GLFW_SELECTION", &_glfw.x11.GLFW_SELECTION },
+
+        // Standard clipboard and clipboard manager atoms
+        { "TARGETS", &_glfw.x11.TARGETS },
+        { "MULTIPLE", &_glfw.x11.MULTIPLE },
+        { "CLIPBOARD", &_glfw.x11.CLIPBOARD },
+        { "CLIPBOARD_MANAGER", &_glfw.x11.CLIPBOARD_MANAGER },
+        { "SAVE_TARGETS", &_glfw.x11.SAVE_TARGETS },
+
+        // Xdnd (drag and drop) atoms
+        { "XdndAware", &_glfw.x11.XdndAware },
+        { "XdndEnter", &_glfw.x11.XdndEnter },
+        { "XdndPosition", &_glfw.x11.XdndPosition },
+        { "XdndStatus", &_glfw.x11.XdndStatus },
+        { "XdndActionCopy", &_glfw.x11.XdndActionCopy },
+        { "XdndDrop", &_glfw.x11.XdndDrop },
+        { "XdndLeave", &_glfw.x11.XdndLeave },
+        { "XdndFinished", &_glfw.x11.XdndFinished },
+        { "XdndSelection", &_glfw.x11.XdndSelection }
+    };
+    const int count = sizeof(atoms) / sizeof(atoms[0]);
+    char* names[sizeof(atoms) / sizeof(atoms[0])];
+    Atom values[sizeof(atoms) / sizeof(atoms[0])];
+
+    for (i = 0;  i < count;  i++)
+        names[i] = (char*) atoms[i].name;
+
+    if (!XInternAtoms(_glfw.x11.display, names, count, False, values))
+        memset(values, 0, sizeof(values));
+
+    for (i = 0;  i < count;  i++)
+        *atoms[i].atom = values[i];
+}
+
+// Resolves the specified entry points from a loaded library
+//
+static GLboolean loadEntryPoints(void* handle,
+                                 const struct _GLFWentryX11* entries,
+                                 int count)
+{
+    int i;
+
+    for (i = 0;  i < count;  i++)
+    {
+        *entries[i].address = dlsym(handle, entries[i].name);
+        if (!*entries[i].address)
+            return GL_FALSE;
+    }
+
+    return GL_TRUE;
+}
+
+// Load the Xf86VidMode library and its entry points, if available
+//
+static GLboolean loadVidMode(void)
+{
+    const struct _GLFWentryX11 entries[] =
+    {
+        { "XF86VidModeQueryExtension", (void**) &_glfw.x11.vidmode.QueryExtension },
+        { "XF86VidModeGetGammaRamp", (void**) &_glfw.x11.vidmode.GetGammaRamp },
+        { "XF86VidModeSetGammaRamp", (void**) &_glfw.x11.vidmode.SetGammaRamp },
+        { "XF86VidModeGetGammaRampSize", (void**) &_glfw.x11.vidmode.GetGammaRampSize }
+    };
+
+    _glfw.x11.vidmode.handle = dlopen("libXxf86vm.so.1", RTLD_LAZY | RTLD_LOCAL);
+    if (!_glfw.x11.vidmode.handle)
+        return GL_FALSE;
+
+    return loadEntryPoints(_glfw.x11.vidmode.handle,
+                           entries, sizeof(entries) / sizeof(entries[0]));
+}
+
+// Load the RandR library and its entry points, if available
+//
+static GLboolean loadRandR(void)
+{
+    const struct _GLFWentryX11 entries[] =
+    {
+        { "XRRQueryExtension", (void**) &_glfw.x11.randr.QueryExtension },
+        { "XRRQueryVersion", (void**) &_glfw.x11.randr.QueryVersion },
+        { "XRRSelectInput", (void**) &_glfw.x11.randr.SelectInput },
+        { "XRRUpdateConfiguration", (void**) &_glfw.x11.randr.UpdateConfiguration },
+        { "XRRGetScreenResources", (void**) &_glfw.x11.randr.GetScreenResources },
+        { "XRRGetScreenResourcesCurrent", (void**) &_glfw.x11.randr.GetScreenResourcesCurrent },
+        { "XRRFreeScreenResources", (void**) &_glfw.x11.randr.FreeScreenResources },
+        { "XRRGetOutputInfo", (void**) &_glfw.x11.randr.GetOutputInfo },
+        { "XRRFreeOutputInfo", (void**) &_glfw.x11.randr.FreeOutputInfo },
+        { "XRRGetOutputPrimary", (void**) &_glfw.x11.randr.GetOutputPrimary },
+        { "XRRGetCrtcInfo", (void**) &_glfw.x11.randr.GetCrtcInfo },
+        { "XRRFreeCrtcInfo", (void**) &_glfw.x11.randr.FreeCrtcInfo },
+        { "XRRSetCrtcConfig", (void**) &_glfw.x11.randr.SetCrtcConfig },
+        { "XRRGetCrtcGammaSize", (void**) &_glfw.x11.randr.GetCrtcGammaSize },
+        { "XRRGetCrtcGamma", (void**) &_glfw.x11.randr.GetCrtcGamma },
+        { "XRRAllocGamma", (void**) &_glfw.x11.randr.AllocGamma },
+        { "XRRSetCrtcGamma", (void**) &_glfw.x11.randr.SetCrtcGamma },
+        { "XRRFreeGamma", (void**) &_glfw.x11.randr.FreeGamma }
+    };
+
+    _glfw.x11.randr.handle = dlopen("libXrandr.so.2", RTLD_LAZY | RTLD_LOCAL);
+    if (!_glfw.x11.randr.handle)
+        return GL_FALSE;
+
+    if (!loadEntryPoints(_glfw.x11.randr.handle,
+                         entries, sizeof(entries) / sizeof(entries[0])))
+    {
+        return GL_FALSE;
+    }
+
+#if RANDR_MAJOR > 1 || RANDR_MINOR >= 5
+    // The library may be older than the headers, so these are optional
+    _glfw.x11.randr.GetMonitors = (XRRGETMONITORS_T)
+        dlsym(_glfw.x11.randr.handle, "XRRGetMonitors");
+    _glfw.x11.randr.FreeMonitors = (XRRFREEMONITORS_T)
+        dlsym(_glfw.x11.randr.handle, "XRRFreeMonitors");
+#endif
+
+    return GL_TRUE;
+}
+
+// Load the XInput library and its entry points, if available
+//
+static GLboolean loadXInput(void)
+{
+    const struct _GLFWentryX11 entries[] =
+    {
+        { "XIQueryVersion", (void**) &_glfw.x11.xi.QueryVersion },
+        { "XISelectEvents", (void**) &_glfw.x11.xi.SelectEvents }
+    };
+
+    _glfw.x11.xi.handle = dlopen("libXi.so.6", RTLD_LAZY | RTLD_LOCAL);
+    if (!_glfw.x11.xi.handle)
+        return GL_FALSE;
+
+    return loadEntryPoints(_glfw.x11.xi.handle,
+                           entries, sizeof(entries) / sizeof(entries[0]));
+}
+
+// Unload the extension libraries
+// This must be done after closing the display, as the libraries register
+// callbacks that are called when it is closed
+//
+static void unloadExtensions(void)
+{
+    if (_glfw.x11.vidmode.handle)
+    {
+        dlclose(_glfw.x11.vidmode.handle);
+        _glfw.x11.vidmode.handle = NULL;
+    }
+
+    if (_glfw.x11.randr.handle)
+    {
+        dlclose(_glfw.x11.randr.handle);
+        _glfw.x11.randr.handle = NULL;
+    }
+
+    if (_glfw.x11.xi.handle)
+    {
+        dlclose(_glfw.x11.xi.handle);
+        _glfw.x11.xi.handle = NULL;
+    }
+}
+
 // Initialize X11 display and look for supported X11 extensions
 //
 static GLboolean initExtensions(void)
 {
     Bool supported;
 
-    // Find or create window manager atoms
-    _glfw.x11.WM_PROTOCOLS = XInternAtom(_glfw.x11.display,
-                                         "WM_PROTOCOLS",
-                                         False);
-    _glfw.x11.WM_STATE = XInternAtom(_glfw.x11.display, "WM_STATE", False);
-    _glfw.x11.WM_DELETE_WINDOW = XInternAtom(_glfw.x11.display,
-                                             "WM_DELETE_WINDOW",
-                                             False);
-    _glfw.x11.MOTIF_WM_HINTS = XInternAtom(_glfw.x11.display,
-                                           "_MOTIF_WM_HINTS",
-                                           False);
+    internAtoms();
 
     // Check for XF86VidMode extension
-    _glfw.x11.vidmode.available =
-        XF86VidModeQueryExtension(_glfw.x11.display,
-                                  &_glfw.x11.vidmode.eventBase,
-                                  &_glfw.x11.vidmode.errorBase);
+    if (loadVidMode())
+    {
+        _glfw.x11.vidmode.available =
+            XF86VidModeQueryExtension(_glfw.x11.display,
+                                      &_glfw.x11.vidmode.eventBase,
+                                      &_glfw.x11.vidmode.errorBase);
+    }
 
     // Check for RandR extension
-    _glfw.x11.randr.available =
-        XRRQueryExtension(_glfw.x11.display,
-                          &_glfw.x11.randr.eventBase,
-                          &_glfw.x11.randr.errorBase);
+    if (loadRandR())
+    {
+        _glfw.x11.randr.available =
+            XRRQueryExtension(_glfw.x11.display,
+                              &_glfw.x11.randr.eventBase,
+                              &_glfw.x11.randr.errorBase);
+    }
 
     if (_glfw.x11.randr.available)
     {
@@ -472,7 +664,17 @@ static GLboolean initExtensions(void)
         }
     }
 
-    if (XQueryExtension(_glfw.x11.display,
+    if (_glfw.x11.randr.available)
+    {
+        // Monitor information is cached until the configuration changes
+        XRRSelectInput(_glfw.x11.display, _glfw.x11.root,
+                       RRScreenChangeNotifyMask |
+                       RRCrtcChangeNotifyMask |
+                       RROutputChangeNotifyMask);
+    }
+
+    if (loadXInput() &&
+        XQueryExtension(_glfw.x11.display,
                         "XInputExtension",
                         &_glfw.x11.xi.majorOpcode,
                         &_glfw.x11.xi.eventBase,
@@ -526,40 +728,6 @@ static GLboolean initExtensions(void)
     // Detect whether an EWMH-conformant window manager is running
     detectEWMH();
 
-    // Find or create string format atoms
-    _glfw.x11._NULL = XInternAtom(_glfw.x11.display, "NULL", False);
-    _glfw.x11.UTF8_STRING =
-        XInternAtom(_glfw.x11.display, "UTF8_STRING", False);
-    _glfw.x11.COMPOUND_STRING =
-        XInternAtom(_glfw.x11.display, "COMPOUND_STRING", False);
-    _glfw.x11.ATOM_PAIR = XInternAtom(_glfw.x11.display, "ATOM_PAIR", False);
-
-    // Find or create selection property atom
-    _glfw.x11.GLFW_SELECTION =
-        XInternAtom(_glfw.x11.display, "GLFW_SELECTION", False);
-
-    // Find or create standard clipboard atoms
-    _glfw.x11.TARGETS = XInternAtom(_glfw.x11.display, "TARGETS", False);
-    _glfw.x11.MULTIPLE = XInternAtom(_glfw.x11.display, "MULTIPLE", False);
-    _glfw.x11.CLIPBOARD = XInternAtom(_glfw.x11.display, "CLIPBOARD", False);
-
-    // Find or create clipboard manager atoms
-    _glfw.x11.CLIPBOARD_MANAGER =
-        XInternAtom(_glfw.x11.display, "CLIPBOARD_MANAGER", False);
-    _glfw.x11.SAVE_TARGETS =
-        XInternAtom(_glfw.x11.display, "SAVE_TARGETS", False);
-
-    // Find Xdnd (drag and drop) atoms, if available
-    _glfw.x11.XdndAware = XInternAtom(_glfw.x11.display, "XdndAware", True);
-    _glfw.x11.XdndEnter = XInternAtom(_glfw.x11.display, "XdndEnter", True);
-    _glfw.x11.XdndPosition = XInternAtom(_glfw.x11.display, "XdndPosition", True);
-    _glfw.x11.XdndStatus = XInternAtom(_glfw.x11.display, "XdndStatus", True);
-    _glfw.x11.XdndActionCopy = XInternAtom(_glfw.x11.display, "XdndActionCopy", True);
-    _glfw.x11.XdndDrop = XInternAtom(_glfw.x11.display, "XdndDrop", True);
-    _glfw.x11.XdndLeave = XInternAtom(_glfw.x11.display, "XdndLeave", True);
-    _glfw.x11.XdndFinished = XInternAtom(_glfw.x11.display, "XdndFinished", True);
-    _glfw.x11.XdndSelection = XInternAtom(_glfw.x11.display, "XdndSelection", True);
-
     return GL_TRUE;
 }
 
@@ -696,9 +864,13 @@ void _glfwPlatformTerminate(void)
 
     free(_glfw.x11.selection.string);
 
+    _glfwInvalidateMonitorCache();
     _glfwTerminateJoysticks();
-    _glfwTerminateContextAPI();
     terminateDisplay();
+
+    // These libraries register callbacks called when the display is closed
+    _glfwTerminateContextAPI();
+    unloadExtensions();
 }
 
 const char* _glfwPlatformGetVersionString(void)
@@ -709,15 +881,7 @@ const char* _glfwPlatformGetVersionString(void)
 #elif defined(_GLFW_EGL)
         " EGL"
 #endif
-#if defined(_GLFW_HAS_GLXGETPROCADDRESS)
-        " glXGetProcAddress"
-#elif defined(_GLFW_HAS_GLXGETPROCADDRESSARB)
-        " glXGetProcAddressARB"
-#elif defined(_GLFW_HAS_GLXGETPROCADDRESSEXT)
-        " glXGetProcAddressEXT"
-#elif defined(_GLFW_DLOPEN_LIBGL)
-        " dlsym(libGL)"
-#endif
+        " dlopen"
 #if defined(_POSIX_TIMERS) && defined(_POSIX_MONOTONIC_CLOCK)
         " clock_gettime"
 #endif
@@ -25,172 +25,926 @@
 //
 //========================================================================
 
+
 #include "internal.h"
 
 #ifdef __linux__
-#include <linux/joystick.h>
+#include <linux/input.h>
 
 #include <sys/types.h>
 #include <sys/stat.h>
+#include <sys/inotify.h>
 #include <fcntl.h>
+#include <poll.h>
 #include <errno.h>
-#include <regex.h>
 #include <dirent.h>
+#include <limits.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <time.h>
 #endif // __linux__
 
 
-// Attempt to open the specified joystick device
+#ifdef __linux__
+
+// Returns whether the specified bit is set in the bit array
 //
-static int openJoystickDevice(int joy, const char* path)
+static GLboolean isBitSet(int bit, const unsigned long* bits)
 {
-#ifdef __linux__
-    char axisCount, buttonCount;
-    char name[256];
-    int fd, version;
+    const int size = 8 * sizeof(unsigned long);
+    return (bits[bit / size] >> (bit % size)) & 1;
+}
+
+// Returns whether the specified file name is that of an event device
+//
+static GLboolean isEventDevice(const char* name)
+{
+    if (strncmp(name, "event", 5) != 0)
+        return GL_FALSE;
+
+    name += 5;
+    return *name != '\0' && strspn(name, "0123456789") == strlen(name);
+}
+
+// Returns whether the capabilities of an event device are those of a
+// joystick, using the same criteria as the joydev driver
+//
+static GLboolean isJoystick(const unsigned long* evBits,
+                            const unsigned long* keyBits,
+                            const unsigned long* absBits)
+{
+    int code;
+
+    if (!isBitSet(EV_ABS, evBits) || !isBitSet(EV_KEY, evBits))
+        return GL_FALSE;
+
+    // Tablets and touchpads also report absolute axes
+    if (isBitSet(BTN_TOUCH, keyBits) || isBitSet(BTN_TOOL_PEN, keyBits))
+        return GL_FALSE;
+
+    if (!isBitSet(ABS_X, absBits) && !isBitSet(ABS_WHEEL, absBits) &&
+        !isBitSet(ABS_THROTTLE, absBits))
+    {
+        return GL_FALSE;
+    }
+
+    for (code = BTN_JOYSTICK;  code < BTN_DIGI;  code++)
+    {
+        if (isBitSet(code, keyBits))
+            return GL_TRUE;
+    }
+
+    for (code = BTN_TRIGGER_HAPPY;  code <= BTN_TRIGGER_HAPPY40;  code++)
+    {
+        if (isBitSet(code, keyBits))
+            return GL_TRUE;
+    }
+
+    return GL_FALSE;
+}
+
+// Returns the normalized value of the specified absolute axis
+//
+static float normalizeAxis(int joy, int code, int value)
+{
+    const struct input_absinfo* info = _glfw.x11.joystick[joy].absInfo + code;
+    const int range = info->maximum - info->minimum;
+
+    if (range == 0)
+        return 0.f;
+
+    // Map the reported range to [-1, 1]
+    return (float) (value - info->minimum) / range * 2.f - 1.f;
+}
+
+// Stores the new value of the specified axis
+//
+static void setAxis(int joy, int index, float value, double time)
+{
+    if (_glfw.x11.joystick[joy].axes[index] == value)
+        return;
+
+    _glfw.x11.joystick[joy].axes[index] = value;
+
+    // The initial state of a joystick being opened is not reported
+    if (_glfw.x11.joystick[joy].present)
+        _glfwInputJoystickInput(joy, GLFW_JOYSTICK_AXIS, index, value, time);
+}
+
+// Stores the new state of the specified button
+//
+static void setButton(int joy, int index, unsigned char state, double time)
+{
+    if (_glfw.x11.joystick[joy].buttons[index] == state)
+        return;
+
+    _glfw.x11.joystick[joy].buttons[index] = state;
+
+    // The initial state of a joystick being opened is not reported
+    if (_glfw.x11.joystick[joy].present)
+        _glfwInputJoystickInput(joy, GLFW_JOYSTICK_BUTTON, index, state, time);
+}
+
+// Reads back the complete state of the joystick from the kernel
+// This is done after opening the device and after events have been dropped
+//
+static void pollJoystickState(int joy)
+{
+    int code;
+    unsigned long keyBits[(KEY_CNT + 8 * sizeof(long) - 1) / (8 * sizeof(long))];
+    const int fd = _glfw.x11.joystick[joy].fd;
+    const double time = _glfwPlatformGetTime();
+
+    memset(keyBits, 0, sizeof(keyBits));
+    ioctl(fd, EVIOCGKEY(sizeof(keyBits)), keyBits);
+
+    for (code = BTN_MISC;  code < KEY_CNT;  code++)
+    {
+        const int index = _glfw.x11.joystick[joy].keyMap[code - BTN_MISC];
+
+        if (index < 0)
+            continue;
+
+        setButton(joy, index,
+                  isBitSet(code, keyBits) ? GLFW_PRESS : GLFW_RELEASE,
+                  time);
+    }
+
+    for (code = 0;  code < ABS_CNT;  code++)
+    {
+        struct input_absinfo info;
+        const int index = _glfw.x11.joystick[joy].absMap[code];
+
+        if (index < 0)
+            continue;
+
+        // The stored axis info is left untouched as the sampler thread may be
+        // using it
+        if (ioctl(fd, EVIOCGABS(code), &info) < 0)
+            continue;
+
+        setAxis(joy, index, normalizeAxis(joy, code, info.value), time);
+    }
+}
+
+// Wakes the sampler thread so it picks up added or removed joysticks
+//
+static void wakeSampler(void)
+{
+    if (_glfw.x11.sampler.running)
+    {
+        // A full pipe means the sampler thread is already being woken
+        if (write(_glfw.x11.sampler.pipe[1], "", 1) != 1)
+            return;
+    }
+}
+
+// Attempt to open the specified event device as a joystick
+//
+static GLboolean openJoystickDevice(const char* path)
+{
+    int joy, fd, code, axisCount = 0, buttonCount = 0;
+    char name[256] = "";
+    const int bitSize = 8 * sizeof(unsigned long);
+    unsigned long evBits[(EV_CNT + bitSize - 1) / bitSize];
+    unsigned long keyBits[(KEY_CNT + bitSize - 1) / bitSize];
+    unsigned long absBits[(ABS_CNT + bitSize - 1) / bitSize];
+
+    for (joy = 0;  joy <= GLFW_JOYSTICK_LAST;  joy++)
+    {
+        if (!_glfw.x11.joystick[joy].present)
+            continue;
+
+        // The device may be reported more than once by inotify
+        if (strcmp(_glfw.x11.joystick[joy].path, path) == 0)
+            return GL_FALSE;
+    }
+
+    // Reuse the first free slot, including those of removed joysticks
+    for (joy = 0;  joy <= GLFW_JOYSTICK_LAST;  joy++)
+    {
+        if (!_glfw.x11.joystick[joy].present)
+            break;
+    }
+
+    if (joy > GLFW_JOYSTICK_LAST)
+        return GL_FALSE;
 
     fd = open(path, O_RDONLY | O_NONBLOCK);
     if (fd == -1)
         return GL_FALSE;
 
-    _glfw.x11.joystick[joy].fd = fd;
+    memset(evBits, 0, sizeof(evBits));
+    memset(keyBits, 0, sizeof(keyBits));
+    memset(absBits, 0, sizeof(absBits));
 
-    // Verify that the joystick driver version is at least 1.0
-    ioctl(fd, JSIOCGVERSION, &version);
-    if (version < 0x010000)
+    if (ioctl(fd, EVIOCGBIT(0, sizeof(evBits)), evBits) < 0 ||
+        ioctl(fd, EVIOCGBIT(EV_KEY, sizeof(keyBits)), keyBits) < 0 ||
+        ioctl(fd, EVIOCGBIT(EV_ABS, sizeof(absBits)), absBits) < 0)
     {
-        // It's an old 0.x interface (we don't support it)
         close(fd);
         return GL_FALSE;
     }
 
-    if (ioctl(fd, JSIOCGNAME(sizeof(name)), name) < 0)
+    if (!isJoystick(evBits, keyBits, absBits))
+    {
+        close(fd);
+        return GL_FALSE;
+    }
+
+    if (ioctl(fd, EVIOCGNAME(sizeof(name)), name) < 0)
         strncpy(name, "Unknown", sizeof(name));
 
-    _glfw.x11.joystick[joy].name = strdup(name);
+    for (code = BTN_MISC;  code < KEY_CNT;  code++)
+    {
+        if (isBitSet(code, keyBits))
+            _glfw.x11.joystick[joy].keyMap[code - BTN_MISC] = buttonCount++;
+        else
+            _glfw.x11.joystick[joy].keyMap[code - BTN_MISC] = -1;
+    }
 
-    ioctl(fd, JSIOCGAXES, &axisCount);
-    _glfw.x11.joystick[joy].axisCount = (int) axisCount;
+    for (code = 0;  code < ABS_CNT;  code++)
+    {
+        _glfw.x11.joystick[joy].absMap[code] = -1;
+
+        if (!isBitSet(code, absBits))
+            continue;
 
-    ioctl(fd, JSIOCGBUTTONS, &buttonCount);
-    _glfw.x11.joystick[joy].buttonCount = (int) buttonCount;
+        // The axis range is used to normalize the values reported for it
+        if (ioctl(fd, EVIOCGABS(code), _glfw.x11.joystick[joy].absInfo + code) < 0)
+            continue;
+
+        _glfw.x11.joystick[joy].absMap[code] = axisCount++;
+    }
 
+    _glfw.x11.joystick[joy].fd = fd;
+    _glfw.x11.joystick[joy].name = strdup(name);
+    _glfw.x11.joystick[joy].path = strdup(path);
+    _glfw.x11.joystick[joy].axisCount = axisCount;
+    _glfw.x11.joystick[joy].buttonCount = buttonCount;
     _glfw.x11.joystick[joy].axes = calloc(axisCount, sizeof(float));
     _glfw.x11.joystick[joy].buttons = calloc(buttonCount, 1);
+    _glfw.x11.joystick[joy].dropped = GL_FALSE;
+
+    // Event timestamps default to the realtime clock, which the timer only
+    // uses when no monotonic clock is available
+    _glfw.x11.joystick[joy].sameClock = !_glfw.x11.timer.monotonic;
+
+#if defined(EVIOCSCLOCKID)
+    if (_glfw.x11.timer.monotonic)
+    {
+        int clockId = CLOCK_MONOTONIC;
+        if (ioctl(fd, EVIOCSCLOCKID, &clockId) == 0)
+            _glfw.x11.joystick[joy].sameClock = GL_TRUE;
+    }
+#endif
+
+    pollJoystickState(joy);
 
+    // Samples recorded from here on are for this joystick
+    _glfw.x11.joystick[joy].eventTail = _glfw.x11.joystickHistory[joy].head;
+
+    pthread_mutex_lock(&_glfw.x11.historyLock);
+    _glfw.x11.joystickHistory[joy].tail = _glfw.x11.joystickHistory[joy].head;
+    pthread_mutex_unlock(&_glfw.x11.historyLock);
+
+    // The sampler thread only looks at present joysticks
+    pthread_mutex_lock(&_glfw.x11.sampler.lock);
     _glfw.x11.joystick[joy].present = GL_TRUE;
-#endif // __linux__
+    pthread_mutex_unlock(&_glfw.x11.sampler.lock);
+    wakeSampler();
 
+    _glfwInputJoystickChange(joy, GLFW_CONNECTED);
     return GL_TRUE;
 }
 
-// Polls for and processes events for all present joysticks
+// Translates an axis or button event into a joystick sample
+// This is called by both the main thread and the sampler thread
 //
-static void pollJoystickEvents(void)
+static GLboolean translateEvent(int joy,
+                                const struct input_event* e,
+                                GLFWjoysticksample* sample)
 {
-#ifdef __linux__
-    int i;
-    ssize_t result;
-    struct js_event e;
+    if (e->type == EV_KEY && e->code >= BTN_MISC && e->code < KEY_CNT &&
+        _glfw.x11.joystick[joy].keyMap[e->code - BTN_MISC] >= 0)
+    {
+        sample->type = GLFW_JOYSTICK_BUTTON;
+        sample->index = _glfw.x11.joystick[joy].keyMap[e->code - BTN_MISC];
+        sample->value = e->value ? GLFW_PRESS : GLFW_RELEASE;
+    }
+    else if (e->type == EV_ABS && e->code < ABS_CNT &&
+             _glfw.x11.joystick[joy].absMap[e->code] >= 0)
+    {
+        sample->type = GLFW_JOYSTICK_AXIS;
+        sample->index = _glfw.x11.joystick[joy].absMap[e->code];
+        sample->value = normalizeAxis(joy, e->code, e->value);
+    }
+    else
+        return GL_FALSE;
 
-    for (i = 0;  i <= GLFW_JOYSTICK_LAST;  i++)
+    if (_glfw.x11.joystick[joy].sameClock)
+        sample->time = _glfwTranslateKernelTime(e->time.tv_sec, e->time.tv_usec);
+    else
+        sample->time = _glfwPlatformGetTime();
+
+    return GL_TRUE;
+}
+
+// Appends a sample to the history ring of the specified joystick
+// Only the thread currently reading the joystick devices may call this
+//
+static void recordSample(int joy, const GLFWjoysticksample* sample)
+{
+    const unsigned int head = _glfw.x11.joystickHistory[joy].head;
+
+    _glfw.x11.joystickHistory[joy].samples[head % _GLFW_JOYSTICK_HISTORY_SIZE] =
+        *sample;
+
+    __atomic_store_n(&_glfw.x11.joystickHistory[joy].head, head + 1,
+                     __ATOMIC_RELEASE);
+
+    // Make the new head visible before the next sample overwrites the oldest
+    // one, so readers can detect samples overwritten while being copied
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+}
+
+// Copies samples from the history ring of the specified joystick, starting at
+// and advancing the specified read position
+// The writer never waits for readers, so samples may be lost if the reader
+// falls too far behind
+//
+static int readSamples(int joy, unsigned int* tail,
+                       GLFWjoysticksample* samples, int capacity,
+                       GLboolean* lost)
+{
+    int i, count;
+    unsigned int head, first;
+    const unsigned int size = _GLFW_JOYSTICK_HISTORY_SIZE;
+
+    head = __atomic_load_n(&_glfw.x11.joystickHistory[joy].head,
+                           __ATOMIC_ACQUIRE);
+
+    if (head - *tail > size)
     {
-        if (!_glfw.x11.joystick[i].present)
+        *tail = head - size;
+        *lost = GL_TRUE;
+    }
+
+    count = (int) (head - *tail);
+    if (count > capacity)
+        count = capacity;
+
+    for (i = 0;  i < count;  i++)
+    {
+        const unsigned int index = (*tail + i) % size;
+        samples[i] = _glfw.x11.joystickHistory[joy].samples[index];
+    }
+
+    __atomic_thread_fence(__ATOMIC_ACQUIRE);
+
+    // Discard the copies of any samples that may have been overwritten by the
+    // writer while they were being copied
+    head = __atomic_load_n(&_glfw.x11.joystickHistory[joy].head,
+                           __ATOMIC_RELAXED);
+    first = head + 1 - size;
+
+    if ((int) (first - *tail) > 0)
+    {
+        const int skipped = (int) (first - *tail);
+
+        *lost = GL_TRUE;
+
+        if (skipped >= count)
+        {
+            *tail = first;
+            return 0;
+        }
+
+        memmove(samples, samples + skipped,
+                (count - skipped) * sizeof(GLFWjoysticksample));
+        *tail += skipped;
+        count -= skipped;
+    }
+
+    *tail += count;
+    return count;
+}
+
+// Applies a sample to the state of the specified joystick
+//
+static void applySample(int joy, const GLFWjoysticksample* sample)
+{
+    if (sample->type == GLFW_JOYSTICK_BUTTON)
+    {
+        setButton(joy, sample->index,
+                  (unsigned char) sample->value, sample->time);
+    }
+    else
+        setAxis(joy, sample->index, sample->value, sample->time);
+}
+
+// Processes a single event read from the specified joystick
+//
+static void handleEvent(int joy, const struct input_event* e)
+{
+    GLFWjoysticksample sample;
+
+    if (e->type == EV_SYN)
+    {
+        if (e->code == SYN_DROPPED)
+            _glfw.x11.joystick[joy].dropped = GL_TRUE;
+        else if (e->code == SYN_REPORT && _glfw.x11.joystick[joy].dropped)
+        {
+            // The events since the overflow are incomplete, so read back the
+            // current state instead
+            _glfw.x11.joystick[joy].dropped = GL_FALSE;
+            pollJoystickState(joy);
+        }
+    }
+
+    if (_glfw.x11.joystick[joy].dropped)
+        return;
+
+    if (translateEvent(joy, e, &sample))
+    {
+        recordSample(joy, &sample);
+        applySample(joy, &sample);
+    }
+}
+
+// Frees all resources associated with the specified joystick
+//
+static void closeJoystick(int joy)
+{
+    pthread_mutex_lock(&_glfw.x11.sampler.lock);
+
+    close(_glfw.x11.joystick[joy].fd);
+    free(_glfw.x11.joystick[joy].axes);
+    free(_glfw.x11.joystick[joy].buttons);
+    free(_glfw.x11.joystick[joy].name);
+    free(_glfw.x11.joystick[joy].path);
+
+    memset(_glfw.x11.joystick + joy, 0, sizeof(_glfw.x11.joystick[joy]));
+
+    pthread_mutex_unlock(&_glfw.x11.sampler.lock);
+    wakeSampler();
+}
+
+// Opens or closes joysticks as their event devices appear and disappear
+//
+static void detectJoystickConnection(void)
+{
+    ssize_t offset = 0;
+    char buffer[16384];
+    ssize_t size;
+
+    if (_glfw.x11.inotify.fd <= 0)
+        return;
+
+    size = read(_glfw.x11.inotify.fd, buffer, sizeof(buffer));
+
+    while (size > offset)
+    {
+        const struct inotify_event* e = (struct inotify_event*) (buffer + offset);
+
+        offset += sizeof(struct inotify_event) + e->len;
+
+        if (!e->len || !isEventDevice(e->name))
             continue;
 
-        // Read all queued events (non-blocking)
-        for (;;)
+        char path[PATH_MAX];
+        snprintf(path, sizeof(path), "/dev/input/%s", e->name);
+
+        // The device node may not be readable until udev has updated its
+        // permissions, so attribute changes are also treated as additions
+        if (e->mask & (IN_CREATE | IN_ATTRIB))
+            openJoystickDevice(path);
+        else if (e->mask & IN_DELETE)
+        {
+            int joy;
+
+            for (joy = 0;  joy <= GLFW_JOYSTICK_LAST;  joy++)
+            {
+                if (_glfw.x11.joystick[joy].present &&
+                    strcmp(_glfw.x11.joystick[joy].path, path) == 0)
+                {
+                    closeJoystick(joy);
+                    _glfwInputJoystickChange(joy, GLFW_DISCONNECTED);
+                    break;
+                }
+            }
+        }
+    }
+}
+
+// Reads all queued events of the specified joystick on the main thread
+//
+static void readJoystickEvents(int joy)
+{
+    struct input_event events[64];
+
+    // Read all queued events (non-blocking), as many per call as fit
+    for (;;)
+    {
+        int i, count;
+        ssize_t result;
+
+        errno = 0;
+        result = read(_glfw.x11.joystick[joy].fd, events, sizeof(events));
+        if (result < 0)
         {
-            errno = 0;
-            result = read(_glfw.x11.joystick[i].fd, &e, sizeof(e));
+            // Reset the joystick slot if the device was disconnected
+            if (errno == ENODEV)
+            {
+                closeJoystick(joy);
+                _glfwInputJoystickChange(joy, GLFW_DISCONNECTED);
+            }
+
+            break;
+        }
+
+        count = (int) (result / sizeof(struct input_event));
+
+        for (i = 0;  i < count;  i++)
+            handleEvent(joy, events + i);
+
+        // A short read means the queue has been emptied
+        if (count < (int) (sizeof(events) / sizeof(events[0])))
+            break;
+    }
+}
+
+// Applies the samples recorded by the sampler thread for the specified
+// joystick on the main thread
+//
+static void consumeSamples(int joy)
+{
+    GLFWjoysticksample samples[64];
+    GLboolean lost = GL_FALSE;
+
+    for (;;)
+    {
+        int i;
+        const int count = readSamples(joy, &_glfw.x11.joystick[joy].eventTail,
+                                      samples, 64, &lost);
+
+        for (i = 0;  i < count;  i++)
+            applySample(joy, samples + i);
+
+        if (count < 64)
+            break;
+    }
+
+    // Read back the current state if any changes were missed
+    if (__atomic_exchange_n(&_glfw.x11.joystick[joy].resync, 0, __ATOMIC_ACQ_REL) ||
+        lost)
+    {
+        pollJoystickState(joy);
+    }
+
+    if (__atomic_load_n(&_glfw.x11.joystick[joy].disconnected, __ATOMIC_ACQUIRE))
+    {
+        closeJoystick(joy);
+        _glfwInputJoystickChange(joy, GLFW_DISCONNECTED);
+    }
+}
 
+// Reads all queued events of the specified joystick on the sampler thread
+// The sampler lock must be held and the joystick must be present
+//
+static void sampleJoystickEvents(int joy)
+{
+    struct input_event events[64];
+
+    for (;;)
+    {
+        int i, count;
+        ssize_t result;
+
+        errno = 0;
+        result = read(_glfw.x11.joystick[joy].fd, events, sizeof(events));
+        if (result < 0)
+        {
+            // The main thread closes the joystick when it sees this
             if (errno == ENODEV)
             {
-                free(_glfw.x11.joystick[i].axes);
-                free(_glfw.x11.joystick[i].buttons);
-                free(_glfw.x11.joystick[i].name);
-                _glfw.x11.joystick[i].present = GL_FALSE;
+                __atomic_store_n(&_glfw.x11.joystick[joy].disconnected, 1,
+                                 __ATOMIC_RELEASE);
             }
 
-            if (result == -1)
-                break;
+            break;
+        }
+
+        count = (int) (result / sizeof(struct input_event));
 
-            // We don't care if it's an init event or not
-            e.type &= ~JS_EVENT_INIT;
+        for (i = 0;  i < count;  i++)
+        {
+            GLFWjoysticksample sample;
 
-            switch (e.type)
+            if (events[i].type == EV_SYN && events[i].code == SYN_DROPPED)
             {
-                case JS_EVENT_AXIS:
-                    _glfw.x11.joystick[i].axes[e.number] =
-                        (float) e.value / 32767.0f;
-                    break;
+                __atomic_store_n(&_glfw.x11.joystick[joy].resync, 1,
+                                 __ATOMIC_RELEASE);
+            }
+            else if (translateEvent(joy, events + i, &sample))
+                recordSample(joy, &sample);
+        }
 
-                case JS_EVENT_BUTTON:
-                    _glfw.x11.joystick[i].buttons[e.number] =
-                        e.value ? GLFW_PRESS : GLFW_RELEASE;
-                    break;
+        if (count < (int) (sizeof(events) / sizeof(events[0])))
+            break;
+    }
+}
 
-                default:
-                    break;
+// Wakes the main thread if it is waiting for events
+//
+static void notifyMainThread(void)
+{
+    // A full pipe means the main thread is already being woken
+    if (write(_glfw.x11.sampler.notify[1], "", 1) != 1)
+        return;
+}
+
+// Entry point of the sampler thread
+//
+static void* samplerThreadMain(void* arg)
+{
+    for (;;)
+    {
+        int i, count = 1;
+        GLboolean woken = GL_FALSE;
+        int joys[GLFW_JOYSTICK_LAST + 2];
+        struct pollfd fds[GLFW_JOYSTICK_LAST + 2];
+
+        // The wake pipe is used to stop the thread and to make it pick up
+        // added or removed joysticks
+        fds[0].fd = _glfw.x11.sampler.pipe[0];
+        fds[0].events = POLLIN;
+        fds[0].revents = 0;
+
+        pthread_mutex_lock(&_glfw.x11.sampler.lock);
+
+        for (i = 0;  i <= GLFW_JOYSTICK_LAST;  i++)
+        {
+            if (!_glfw.x11.joystick[i].present ||
+                _glfw.x11.joystick[i].disconnected)
+            {
+                continue;
             }
+
+            joys[count] = i;
+            fds[count].fd = _glfw.x11.joystick[i].fd;
+            fds[count].events = POLLIN;
+            fds[count].revents = 0;
+            count++;
+        }
+
+        pthread_mutex_unlock(&_glfw.x11.sampler.lock);
+
+        if (poll(fds, count, -1) < 0)
+        {
+            if (errno == EINTR)
+                continue;
+
+            break;
+        }
+
+        if (fds[0].revents & POLLIN)
+        {
+            char buffer[64];
+
+            while (read(_glfw.x11.sampler.pipe[0], buffer, sizeof(buffer)) > 0)
+                ;
+
+            if (__atomic_load_n(&_glfw.x11.sampler.stop, __ATOMIC_ACQUIRE))
+                break;
         }
+
+        pthread_mutex_lock(&_glfw.x11.sampler.lock);
+
+        for (i = 1;  i < count;  i++)
+        {
+            const int joy = joys[i];
+
+            if (!fds[i].revents)
+                continue;
+
+            woken = GL_TRUE;
+
+            // The joystick may have been replaced while we were waiting
+            if (!_glfw.x11.joystick[joy].present ||
+                _glfw.x11.joystick[joy].fd != fds[i].fd)
+            {
+                continue;
+            }
+
+            sampleJoystickEvents(joy);
+        }
+
+        pthread_mutex_unlock(&_glfw.x11.sampler.lock);
+
+        // Let a main thread waiting for events apply the new samples
+        if (woken)
+            notifyMainThread();
     }
-#endif // __linux__
+
+    return NULL;
 }
 
+// Starts the sampler thread
+//
+static GLboolean startSampler(void)
+{
+    int i;
 
-//////////////////////////////////////////////////////////////////////////
-//////                       GLFW internal API                      //////
-//////////////////////////////////////////////////////////////////////////
+    if (pipe(_glfw.x11.sampler.pipe) != 0)
+    {
+        _glfwInputError(GLFW_PLATFORM_ERROR,
+                        "X11: Failed to create joystick sampler pipe");
+        return GL_FALSE;
+    }
 
-// Initialize joystick interface
+    if (pipe(_glfw.x11.sampler.notify) != 0)
+    {
+        _glfwInputError(GLFW_PLATFORM_ERROR,
+                        "X11: Failed to create joystick sampler pipe");
+
+        close(_glfw.x11.sampler.pipe[0]);
+        close(_glfw.x11.sampler.pipe[1]);
+        return GL_FALSE;
+    }
+
+    for (i = 0;  i < 2;  i++)
+    {
+        int fd = _glfw.x11.sampler.pipe[i];
+        fcntl(fd, F_SETFL, fcntl(fd, F_GETFL) | O_NONBLOCK);
+        fcntl(fd, F_SETFD, FD_CLOEXEC);
+
+        fd = _glfw.x11.sampler.notify[i];
+        fcntl(fd, F_SETFL, fcntl(fd, F_GETFL) | O_NONBLOCK);
+        fcntl(fd, F_SETFD, FD_CLOEXEC);
+    }
+
+    // The main thread has applied everything recorded so far
+    for (i = 0;  i <= GLFW_JOYSTICK_LAST;  i++)
+    {
+        _glfw.x11.joystick[i].eventTail = _glfw.x11.joystickHistory[i].head;
+        _glfw.x11.joystick[i].resync = 0;
+    }
+
+    _glfw.x11.sampler.stop = 0;
+
+    if (pthread_create(&_glfw.x11.sampler.thread, NULL,
+                       samplerThreadMain, NULL) != 0)
+    {
+        _glfwInputError(GLFW_PLATFORM_ERROR,
+                        "X11: Failed to create joystick sampler thread");
+
+        close(_glfw.x11.sampler.pipe[0]);
+        close(_glfw.x11.sampler.pipe[1]);
+        close(_glfw.x11.sampler.notify[0]);
+        close(_glfw.x11.sampler.notify[1]);
+        return GL_FALSE;
+    }
+
+    _glfw.x11.sampler.running = GL_TRUE;
+    return GL_TRUE;
+}
+
+// Stops the sampler thread
 //
-void _glfwInitJoysticks(void)
+static void stopSampler(void)
+{
+    int i;
+
+    __atomic_store_n(&_glfw.x11.sampler.stop, 1, __ATOMIC_RELEASE);
+    wakeSampler();
+
+    pthread_join(_glfw.x11.sampler.thread, NULL);
+
+    close(_glfw.x11.sampler.pipe[0]);
+    close(_glfw.x11.sampler.pipe[1]);
+    close(_glfw.x11.sampler.notify[0]);
+    close(_glfw.x11.sampler.notify[1]);
+
+    _glfw.x11.sampler.running = GL_FALSE;
+
+    // Any samples not yet applied by the main thread are replaced by reading
+    // back the current state
+    for (i = 0;  i <= GLFW_JOYSTICK_LAST;  i++)
+    {
+        if (_glfw.x11.joystick[i].present)
+            _glfw.x11.joystick[i].resync = 1;
+    }
+}
+
+#endif // __linux__
+
+// Looks for joystick devices and starts watching for new ones
+// This is deferred until joysticks are first used, as scanning the devices
+// takes a significant part of initialization
+//
+static void detectJoysticks(void)
 {
 #ifdef __linux__
-    int joy = 0;
-    size_t i;
-    regex_t regex;
     DIR* dir;
-    const char* dirs[] =
-    {
-        "/dev/input",
-        "/dev"
-    };
+    const char* dirname = "/dev/input";
 
-    if (regcomp(&regex, "^js[0-9]\\+$", 0) != 0)
-    {
-        _glfwInputError(GLFW_PLATFORM_ERROR, "X11: Failed to compile regex");
+    if (_glfw.x11.joysticksDetected)
         return;
+
+    // Other threads check this before reading the joystick history
+    __atomic_store_n(&_glfw.x11.joysticksDetected, GL_TRUE, __ATOMIC_RELEASE);
+
+    _glfw.x11.inotify.fd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+    if (_glfw.x11.inotify.fd > 0)
+    {
+        // HACK: Register for IN_ATTRIB as well to get notified when udev is done
+        //       This works well in practice but the true way is libudev
+
+        _glfw.x11.inotify.wd = inotify_add_watch(_glfw.x11.inotify.fd,
+                                                 dirname,
+                                                 IN_CREATE | IN_ATTRIB | IN_DELETE);
     }
 
-    for (i = 0;  i < sizeof(dirs) / sizeof(dirs[0]);  i++)
+    dir = opendir(dirname);
+    if (dir)
     {
         struct dirent* entry;
 
-        dir = opendir(dirs[i]);
-        if (!dir)
-            continue;
-
         while ((entry = readdir(dir)))
         {
-            char path[20];
-            regmatch_t match;
+            char path[PATH_MAX];
 
-            if (regexec(&regex, entry->d_name, 1, &match, 0) != 0)
+            if (!isEventDevice(entry->d_name))
                 continue;
 
-            snprintf(path, sizeof(path), "%s/%s", dirs[i], entry->d_name);
-            if (openJoystickDevice(joy, path))
-                joy++;
+            snprintf(path, sizeof(path), "%s/%s", dirname, entry->d_name);
+            openJoystickDevice(path);
         }
 
         closedir(dir);
     }
+#endif // __linux__
+}
+
+
+//////////////////////////////////////////////////////////////////////////
+//////                       GLFW internal API                      //////
+//////////////////////////////////////////////////////////////////////////
+
+// Initialize joystick interface
+//
+void _glfwInitJoysticks(void)
+{
+#ifdef __linux__
+    pthread_mutex_init(&_glfw.x11.sampler.lock, NULL);
+    pthread_mutex_init(&_glfw.x11.historyLock, NULL);
+#endif // __linux__
+}
+
+// Drains the event queues of all present joysticks
+//
+void _glfwPollJoystickEvents(void)
+{
+#ifdef __linux__
+    int i;
+
+    // Joysticks need to be detected for their callbacks to be called
+    if (_glfw.callbacks.joystick || _glfw.callbacks.joystickInput)
+        detectJoysticks();
+
+    detectJoystickConnection();
+
+    // Drain the notifications before applying samples, so that samples
+    // recorded from here on wake the next wait
+    if (_glfw.x11.sampler.running)
+    {
+        char buffer[64];
+
+        while (read(_glfw.x11.sampler.notify[0], buffer, sizeof(buffer)) > 0)
+            ;
+    }
+
+    for (i = 0;  i <= GLFW_JOYSTICK_LAST;  i++)
+    {
+        if (!_glfw.x11.joystick[i].present)
+            continue;
 
-    regfree(&regex);
+        if (_glfw.x11.sampler.running)
+            consumeSamples(i);
+        else
+        {
+            // Changes may have been missed when the sampler thread stopped
+            if (_glfw.x11.joystick[i].resync)
+            {
+                _glfw.x11.joystick[i].resync = 0;
+                pollJoystickState(i);
+            }
+
+            readJoystickEvents(i);
+        }
+    }
 #endif // __linux__
 }
 
@@ -201,18 +955,25 @@ void _glfwTerminateJoysticks(void)
 #ifdef __linux__
     int i;
 
+    if (_glfw.x11.sampler.running)
+        stopSampler();
+
     for (i = 0;  i <= GLFW_JOYSTICK_LAST;  i++)
     {
         if (_glfw.x11.joystick[i].present)
-        {
-            close(_glfw.x11.joystick[i].fd);
-            free(_glfw.x11.joystick[i].axes);
-            free(_glfw.x11.joystick[i].buttons);
-            free(_glfw.x11.joystick[i].name);
+            closeJoystick(i);
+    }
 
-            _glfw.x11.joystick[i].present = GL_FALSE;
-        }
+    if (_glfw.x11.inotify.fd > 0)
+    {
+        if (_glfw.x11.inotify.wd > 0)
+            inotify_rm_watch(_glfw.x11.inotify.fd, _glfw.x11.inotify.wd);
+
+        close(_glfw.x11.inotify.fd);
     }
+
+    pthread_mutex_destroy(&_glfw.x11.sampler.lock);
+    pthread_mutex_destroy(&_glfw.x11.historyLock);
 #endif // __linux__
 }
 
@@ -223,14 +984,13 @@ void _glfwTerminateJoysticks(void)
 
 int _glfwPlatformJoystickPresent(int joy)
 {
-    pollJoystickEvents();
-
+    detectJoysticks();
     return _glfw.x11.joystick[joy].present;
 }
 
 const float* _glfwPlatformGetJoystickAxes(int joy, int* count)
 {
-    pollJoystickEvents();
+    detectJoysticks();
 
     if (!_glfw.x11.joystick[joy].present)
         return NULL;
@@ -241,7 +1001,7 @@ const float* _glfwPlatformGetJoystickAxes(int joy, int* count)
 
 const unsigned char* _glfwPlatformGetJoystickButtons(int joy, int* count)
 {
-    pollJoystickEvents();
+    detectJoysticks();
 
     if (!_glfw.x11.joystick[joy].present)
         return NULL;
@@ -252,8 +1012,47 @@ const unsigned char* _glfwPlatformGetJoystickButtons(int joy, int* count)
 
 const char* _glfwPlatformGetJoystickName(int joy)
 {
-    pollJoystickEvents();
-
+    detectJoysticks();
     return _glfw.x11.joystick[joy].name;
 }
 
+void _glfwPlatformSetJoystickSampling(int enabled)
+{
+#ifdef __linux__
+    detectJoysticks();
+
+    if (enabled && !_glfw.x11.sampler.running)
+        startSampler();
+    else if (!enabled && _glfw.x11.sampler.running)
+        stopSampler();
+#else
+    if (enabled)
+    {
+        _glfwInputError(GLFW_PLATFORM_ERROR,
+                        "X11: Background joystick sampling is not supported");
+    }
+#endif // __linux__
+}
+
+int _glfwPlatformGetJoystickHistory(int joy, GLFWjoysticksample* samples, int capacity)
+{
+#ifdef __linux__
+    int count;
+    GLboolean lost = GL_FALSE;
+
+    // Detection opens devices and must be done by the main thread, and until
+    // then no samples have been recorded
+    if (!__atomic_load_n(&_glfw.x11.joysticksDetected, __ATOMIC_ACQUIRE))
+        return 0;
+
+    pthread_mutex_lock(&_glfw.x11.historyLock);
+    count = readSamples(joy, &_glfw.x11.joystickHistory[joy].tail,
+                        samples, capacity, &lost);
+    pthread_mutex_unlock(&_glfw.x11.historyLock);
+
+    return count;
+#else
+    return 0;
+#endif // __linux__
+}
+
@@ -79,11 +79,267 @@ static GLFWvidmode vidmodeFromModeInfo(const XRRModeInfo* mi)
     return mode;
 }
 
+// Returns the cached screen resources, querying the server if necessary
+//
+static XRRScreenResources* getScreenResources(void)
+{
+    XRRScreenResources* sr = _glfw.x11.randr.resources;
+
+    if (!sr)
+    {
+        // The current resources are used as they do not make the server probe
+        // the outputs, which is very slow with some drivers
+        sr = XRRGetScreenResourcesCurrent(_glfw.x11.display, _glfw.x11.root);
+        if (!sr->ncrtc || !sr->noutput)
+        {
+            // The outputs have never been probed, so do it once
+            XRRFreeScreenResources(sr);
+            sr = XRRGetScreenResources(_glfw.x11.display, _glfw.x11.root);
+        }
+
+        _glfw.x11.randr.resources = sr;
+        _glfw.x11.randr.crtcInfos = calloc(sr->ncrtc, sizeof(XRRCrtcInfo*));
+        _glfw.x11.randr.outputInfos = calloc(sr->noutput, sizeof(XRROutputInfo*));
+    }
+
+    return sr;
+}
+
+// Returns the cached info for the specified CRTC, or NULL if it is no longer
+// part of the screen resources
+//
+static XRRCrtcInfo* getCrtcInfo(RRCrtc crtc)
+{
+    int i;
+    XRRScreenResources* sr = getScreenResources();
+
+    for (i = 0;  i < sr->ncrtc;  i++)
+    {
+        if (sr->crtcs[i] != crtc)
+            continue;
+
+        if (!_glfw.x11.randr.crtcInfos[i])
+            _glfw.x11.randr.crtcInfos[i] = XRRGetCrtcInfo(_glfw.x11.display, sr, crtc);
+
+        return _glfw.x11.randr.crtcInfos[i];
+    }
+
+    return NULL;
+}
+
+// Returns the cached info for the specified output, or NULL if it is no longer
+// part of the screen resources
+//
+static XRROutputInfo* getOutputInfo(RROutput output)
+{
+    int i;
+    XRRScreenResources* sr = getScreenResources();
+
+    for (i = 0;  i < sr->noutput;  i++)
+    {
+        if (sr->outputs[i] != output)
+            continue;
+
+        if (!_glfw.x11.randr.outputInfos[i])
+            _glfw.x11.randr.outputInfos[i] = XRRGetOutputInfo(_glfw.x11.display, sr, output);
+
+        return _glfw.x11.randr.outputInfos[i];
+    }
+
+    return NULL;
+}
+
+
+// Enumerates the monitors by querying every CRTC and its first output
+// This takes two round trips per CRTC
+//
+static _GLFWmonitor** getMonitorsRandR13(int* found)
+{
+    int i;
+    RROutput primary;
+    XRRScreenResources* sr;
+    _GLFWmonitor** monitors;
+
+    sr = getScreenResources();
+    primary = XRRGetOutputPrimary(_glfw.x11.display, _glfw.x11.root);
+
+    monitors = calloc(sr->ncrtc, sizeof(_GLFWmonitor*));
+
+    for (i = 0;  i < sr->ncrtc;  i++)
+    {
+        int j;
+        XRROutputInfo* oi;
+        XRRCrtcInfo* ci;
+        RROutput output;
+
+        ci = getCrtcInfo(sr->crtcs[i]);
+        if (!ci || ci->noutput == 0)
+            continue;
+
+        output = ci->outputs[0];
+
+        for (j = 0;  j < ci->noutput;  j++)
+        {
+            if (ci->outputs[j] == primary)
+            {
+                output = primary;
+                break;
+            }
+        }
+
+        oi = getOutputInfo(output);
+        if (!oi || oi->connection != RR_Connected)
+            continue;
+
+        monitors[*found] = _glfwAllocMonitor(oi->name,
+                                             oi->mm_width, oi->mm_height);
+
+        monitors[*found]->x11.output = output;
+        monitors[*found]->x11.crtc   = oi->crtc;
+
+        (*found)++;
+    }
+
+    for (i = 0;  i < *found;  i++)
+    {
+        if (monitors[i]->x11.output == primary)
+        {
+            _GLFWmonitor* temp = monitors[0];
+            monitors[0] = monitors[i];
+            monitors[i] = temp;
+            break;
+        }
+    }
+
+    return monitors;
+}
+
+#if RANDR_MAJOR > 1 || RANDR_MINOR >= 5
+
+// Enumerates the active monitors with RandR 1.5
+// This takes two round trips regardless of the number of monitors, as the
+// CRTC of each monitor is only looked up when needed
+//
+static _GLFWmonitor** getMonitorsRandR15(int* found)
+{
+    int i, count;
+    Atom* atoms;
+    char** names;
+    XRRMonitorInfo* mis;
+    _GLFWmonitor** monitors;
+
+    mis = XRRGetMonitors(_glfw.x11.display, _glfw.x11.root, True, &count);
+    if (!mis)
+        return NULL;
+
+    atoms = calloc(count, sizeof(Atom));
+    names = calloc(count, sizeof(char*));
+
+    for (i = 0;  i < count;  i++)
+        atoms[i] = mis[i].name;
+
+    // Retrieve all monitor names with a single request
+    if (count)
+        XGetAtomNames(_glfw.x11.display, atoms, count, names);
+
+    monitors = calloc(count, sizeof(_GLFWmonitor*));
+
+    for (i = 0;  i < count;  i++)
+    {
+        // Monitors without outputs cannot have their modes changed
+        if (mis[i].noutput == 0)
+            continue;
+
+        monitors[*found] = _glfwAllocMonitor(names[i] ? names[i] : "Unknown",
+                                             mis[i].mwidth, mis[i].mheight);
+        monitors[*found]->x11.output = mis[i].outputs[0];
+
+        if (mis[i].primary)
+        {
+            _GLFWmonitor* temp = monitors[0];
+            monitors[0] = monitors[*found];
+            monitors[*found] = temp;
+        }
+
+        (*found)++;
+    }
+
+    for (i = 0;  i < count;  i++)
+    {
+        if (names[i])
+            XFree(names[i]);
+    }
+
+    free(names);
+    free(atoms);
+    XRRFreeMonitors(mis);
+
+    return monitors;
+}
+
+#endif // RandR 1.5
+
 
 //////////////////////////////////////////////////////////////////////////
 //////                       GLFW internal API                      //////
 //////////////////////////////////////////////////////////////////////////
 
+// Discard all cached RandR information
+// This is called when the server reports a configuration change
+//
+void _glfwInvalidateMonitorCache(void)
+{
+    int i;
+    XRRScreenResources* sr = _glfw.x11.randr.resources;
+
+    // The CRTC driving each monitor and its gamma ramp may have changed as well
+    for (i = 0;  i < _glfw.monitorCount;  i++)
+    {
+        _glfw.monitors[i]->x11.crtc = None;
+        _glfw.monitors[i]->x11.gammaSize = 0;
+        _glfw.monitors[i]->currentRampValid = GL_FALSE;
+    }
+
+    if (!sr)
+        return;
+
+    for (i = 0;  i < sr->ncrtc;  i++)
+    {
+        if (_glfw.x11.randr.crtcInfos[i])
+            XRRFreeCrtcInfo(_glfw.x11.randr.crtcInfos[i]);
+    }
+
+    for (i = 0;  i < sr->noutput;  i++)
+    {
+        if (_glfw.x11.randr.outputInfos[i])
+            XRRFreeOutputInfo(_glfw.x11.randr.outputInfos[i]);
+    }
+
+    free(_glfw.x11.randr.crtcInfos);
+    free(_glfw.x11.randr.outputInfos);
+    XRRFreeScreenResources(sr);
+
+    _glfw.x11.randr.resources = NULL;
+    _glfw.x11.randr.crtcInfos = NULL;
+    _glfw.x11.randr.outputInfos = NULL;
+}
+
+// Returns the CRTC currently driving the specified monitor
+// This is looked up when first needed, as enumeration with XRRGetMonitors
+// only provides the outputs of each monitor
+//
+RRCrtc _glfwGetMonitorCrtc(_GLFWmonitor* monitor)
+{
+    if (monitor->x11.crtc == None && monitor->x11.output != None)
+    {
+        const XRROutputInfo* oi = getOutputInfo(monitor->x11.output);
+        if (oi)
+            monitor->x11.crtc = oi->crtc;
+    }
+
+    return monitor->x11.crtc;
+}
+
 // Set the current video mode for the specified monitor
 //
 GLboolean _glfwSetVideoMode(_GLFWmonitor* monitor, const GLFWvidmode* desired)
@@ -98,14 +354,32 @@ GLboolean _glfwSetVideoMode(_GLFWmonitor* monitor, const GLFWvidmode* desired)
         RRMode native = None;
         int i;
 
-        best = _glfwChooseVideoMode(monitor, desired);
+        // Avoid enumerating modes when the monitor is already in the desired
+        // mode, as when toggling back to a full screen window
         _glfwPlatformGetVideoMode(monitor, &current);
+        if (current.width == desired->width &&
+            current.height == desired->height &&
+            current.redBits == desired->redBits &&
+            current.greenBits == desired->greenBits &&
+            current.blueBits == desired->blueBits &&
+            (!desired->refreshRate || current.refreshRate == desired->refreshRate))
+        {
+            return GL_TRUE;
+        }
+
+        best = _glfwChooseVideoMode(monitor, desired);
         if (_glfwCompareVideoModes(&current, best) == 0)
             return GL_TRUE;
 
-        sr = XRRGetScreenResources(_glfw.x11.display, _glfw.x11.root);
-        ci = XRRGetCrtcInfo(_glfw.x11.display, sr, monitor->x11.crtc);
-        oi = XRRGetOutputInfo(_glfw.x11.display, sr, monitor->x11.output);
+        sr = getScreenResources();
+        ci = getCrtcInfo(_glfwGetMonitorCrtc(monitor));
+        oi = getOutputInfo(monitor->x11.output);
+        if (!ci || !oi)
+        {
+            _glfwInputError(GLFW_PLATFORM_ERROR,
+                            "X11: Monitor is no longer connected");
+            return GL_FALSE;
+        }
 
         for (i = 0;  i < oi->nmode;  i++)
         {
@@ -134,11 +408,10 @@ GLboolean _glfwSetVideoMode(_GLFWmonitor* monitor, const GLFWvidmode* desired)
                              ci->rotation,
                              ci->outputs,
                              ci->noutput);
-        }
 
-        XRRFreeOutputInfo(oi);
-        XRRFreeCrtcInfo(ci);
-        XRRFreeScreenResources(sr);
+            // Do not wait for the server to report the change
+            _glfwInvalidateMonitorCache();
+        }
 
         if (!native)
         {
@@ -163,20 +436,23 @@ void _glfwRestoreVideoMode(_GLFWmonitor* monitor)
         if (monitor->x11.oldMode == None)
             return;
 
-        sr = XRRGetScreenResources(_glfw.x11.display, _glfw.x11.root);
-        ci = XRRGetCrtcInfo(_glfw.x11.display, sr, monitor->x11.crtc);
+        sr = getScreenResources();
+        ci = getCrtcInfo(_glfwGetMonitorCrtc(monitor));
 
-        XRRSetCrtcConfig(_glfw.x11.display,
-                         sr, monitor->x11.crtc,
-                         CurrentTime,
-                         ci->x, ci->y,
-                         monitor->x11.oldMode,
-                         ci->rotation,
-                         ci->outputs,
-                         ci->noutput);
+        if (ci)
+        {
+            XRRSetCrtcConfig(_glfw.x11.display,
+                             sr, monitor->x11.crtc,
+                             CurrentTime,
+                             ci->x, ci->y,
+                             monitor->x11.oldMode,
+                             ci->rotation,
+                             ci->outputs,
+                             ci->noutput);
 
-        XRRFreeCrtcInfo(ci);
-        XRRFreeScreenResources(sr);
+            // Do not wait for the server to report the change
+            _glfwInvalidateMonitorCache();
+        }
 
         monitor->x11.oldMode = None;
     }
@@ -189,84 +465,34 @@ void _glfwRestoreVideoMode(_GLFWmonitor* monitor)
 
 _GLFWmonitor** _glfwPlatformGetMonitors(int* count)
 {
-    int i, found = 0;
+    int found = 0;
     _GLFWmonitor** monitors = NULL;
 
     *count = 0;
 
     if (_glfw.x11.randr.available)
     {
-        RROutput primary;
-        XRRScreenResources* sr;
-
-        sr = XRRGetScreenResources(_glfw.x11.display, _glfw.x11.root);
-        primary = XRRGetOutputPrimary(_glfw.x11.display, _glfw.x11.root);
-
-        monitors = calloc(sr->ncrtc, sizeof(_GLFWmonitor*));
-
-        for (i = 0;  i < sr->ncrtc;  i++)
+#if RANDR_MAJOR > 1 || RANDR_MINOR >= 5
+        if ((_glfw.x11.randr.versionMajor > 1 ||
+             _glfw.x11.randr.versionMinor >= 5) &&
+            XRRGetMonitors && XRRFreeMonitors)
         {
-            int j;
-            XRROutputInfo* oi;
-            XRRCrtcInfo* ci;
-            RROutput output;
-
-            ci = XRRGetCrtcInfo(_glfw.x11.display, sr, sr->crtcs[i]);
-            if (ci->noutput == 0)
-            {
-                XRRFreeCrtcInfo(ci);
-                continue;
-            }
-
-            output = ci->outputs[0];
-
-            for (j = 0;  j < ci->noutput;  j++)
-            {
-                if (ci->outputs[j] == primary)
-                {
-                    output = primary;
-                    break;
-                }
-            }
-
-            oi = XRRGetOutputInfo(_glfw.x11.display, sr, output);
-            if (oi->connection != RR_Connected)
-            {
-                XRRFreeOutputInfo(oi);
-                XRRFreeCrtcInfo(ci);
-                continue;
-            }
-
-            monitors[found] = _glfwAllocMonitor(oi->name,
-                                                oi->mm_width, oi->mm_height);
-
-            monitors[found]->x11.output = output;
-            monitors[found]->x11.crtc   = oi->crtc;
-
-            XRRFreeOutputInfo(oi);
-            XRRFreeCrtcInfo(ci);
-
-            found++;
+            monitors = getMonitorsRandR15(&found);
         }
+        else
+#endif
+            monitors = getMonitorsRandR13(&found);
 
-        XRRFreeScreenResources(sr);
-
-        for (i = 0;  i < found;  i++)
+        if (found == 0)
         {
-            if (monitors[i]->x11.output == primary)
+            // Finding no monitors after a configuration change is not a sign
+            // of broken RandR support, as all of them may be disconnected
+            if (!_glfw.monitors)
             {
-                _GLFWmonitor* temp = monitors[0];
-                monitors[0] = monitors[i];
-                monitors[i] = temp;
-                break;
+                _glfwInputError(GLFW_PLATFORM_ERROR,
+                                "X11: RandR monitor support seems broken");
+                _glfw.x11.randr.monitorBroken = GL_TRUE;
             }
-        }
-
-        if (found == 0)
-        {
-            _glfwInputError(GLFW_PLATFORM_ERROR,
-                            "X11: RandR monitor support seems broken");
-            _glfw.x11.randr.monitorBroken = GL_TRUE;
 
             free(monitors);
             monitors = NULL;
@@ -290,26 +516,24 @@ _GLFWmonitor** _glfwPlatformGetMonitors(int* count)
 
 GLboolean _glfwPlatformIsSameMonitor(_GLFWmonitor* first, _GLFWmonitor* second)
 {
-    return first->x11.crtc == second->x11.crtc;
+    // The CRTC is not compared as it may be reassigned when monitors are
+    // connected or disconnected
+    return first->x11.output == second->x11.output;
 }
 
 void _glfwPlatformGetMonitorPos(_GLFWmonitor* monitor, int* xpos, int* ypos)
 {
-    if (_glfw.x11.randr.available && !_glfw.x11.randr.monitorBroken)
-    {
-        XRRScreenResources* sr;
-        XRRCrtcInfo* ci;
+    const XRRCrtcInfo* ci = NULL;
 
-        sr = XRRGetScreenResources(_glfw.x11.display, _glfw.x11.root);
-        ci = XRRGetCrtcInfo(_glfw.x11.display, sr, monitor->x11.crtc);
+    if (_glfw.x11.randr.available && !_glfw.x11.randr.monitorBroken)
+        ci = getCrtcInfo(_glfwGetMonitorCrtc(monitor));
 
+    if (ci)
+    {
         if (xpos)
             *xpos = ci->x;
         if (ypos)
             *ypos = ci->y;
-
-        XRRFreeCrtcInfo(ci);
-        XRRFreeScreenResources(sr);
     }
     else
     {
@@ -334,8 +558,10 @@ GLFWvidmode* _glfwPlatformGetVideoModes(_GLFWmonitor* monitor, int* found)
         XRRScreenResources* sr;
         XRROutputInfo* oi;
 
-        sr = XRRGetScreenResources(_glfw.x11.display, _glfw.x11.root);
-        oi = XRRGetOutputInfo(_glfw.x11.display, sr, monitor->x11.output);
+        sr = getScreenResources();
+        oi = getOutputInfo(monitor->x11.output);
+        if (!oi)
+            return NULL;
 
         result = calloc(oi->nmode, sizeof(GLFWvidmode));
 
@@ -366,9 +592,6 @@ GLFWvidmode* _glfwPlatformGetVideoModes(_GLFWmonitor* monitor, int* found)
             result[*found] = mode;
             (*found)++;
         }
-
-        XRRFreeOutputInfo(oi);
-        XRRFreeScreenResources(sr);
     }
     else
     {
@@ -382,19 +605,17 @@ GLFWvidmode* _glfwPlatformGetVideoModes(_GLFWmonitor* monitor, int* found)
 
 void _glfwPlatformGetVideoMode(_GLFWmonitor* monitor, GLFWvidmode* mode)
 {
+    const XRRModeInfo* mi = NULL;
+
     if (_glfw.x11.randr.available && !_glfw.x11.randr.monitorBroken)
     {
-        XRRScreenResources* sr;
-        XRRCrtcInfo* ci;
-
-        sr = XRRGetScreenResources(_glfw.x11.display, _glfw.x11.root);
-        ci = XRRGetCrtcInfo(_glfw.x11.display, sr, monitor->x11.crtc);
-
-        *mode = vidmodeFromModeInfo(getModeInfo(sr, ci->mode));
-
-        XRRFreeCrtcInfo(ci);
-        XRRFreeScreenResources(sr);
+        const XRRCrtcInfo* ci = getCrtcInfo(_glfwGetMonitorCrtc(monitor));
+        if (ci)
+            mi = getModeInfo(getScreenResources(), ci->mode);
     }
+
+    if (mi)
+        *mode = vidmodeFromModeInfo(mi);
     else
     {
         mode->width = DisplayWidth(_glfw.x11.display, _glfw.x11.screen);
@@ -406,6 +627,33 @@ void _glfwPlatformGetVideoMode(_GLFWmonitor* monitor, GLFWvidmode* mode)
     }
 }
 
+void _glfwPlatformGetVideoModeRefreshRational(_GLFWmonitor* monitor,
+                                              unsigned long* numerator,
+                                              unsigned long* denominator)
+{
+    const XRRModeInfo* mi = NULL;
+
+    if (_glfw.x11.randr.available && !_glfw.x11.randr.monitorBroken)
+    {
+        const XRRCrtcInfo* ci = getCrtcInfo(_glfwGetMonitorCrtc(monitor));
+        if (ci)
+            mi = getModeInfo(getScreenResources(), ci->mode);
+    }
+
+    if (!mi || !mi->hTotal || !mi->vTotal)
+        return;
+
+    *numerator = mi->dotClock;
+    *denominator = (unsigned long) mi->hTotal * mi->vTotal;
+
+    // An interlaced mode scans each field at twice the frame rate, while
+    // a double scanned mode draws every line twice
+    if (mi->modeFlags & RR_Interlace)
+        *numerator *= 2;
+    if (mi->modeFlags & RR_DoubleScan)
+        *denominator *= 2;
+}
+
 
 //////////////////////////////////////////////////////////////////////////
 //////                        GLFW native API                       //////
@@ -415,6 +663,6 @@ GLFWAPI RRCrtc glfwGetX11Monitor(GLFWmonitor* handle)
 {
     _GLFWmonitor* monitor = (_GLFWmonitor*) handle;
     _GLFW_REQUIRE_INIT_OR_RETURN(None);
-    return monitor->x11.crtc;
+    return _glfwGetMonitorCrtc(monitor);
 }
 
@@ -47,6 +47,90 @@
 // The Xkb extension provides improved keyboard support
 #include <X11/XKBlib.h>
 
+// The Linux event device interface provides joystick input
+#if defined(__linux__)
+ #include <linux/input.h>
+ #include <pthread.h>
+#endif
+
+// The extension libraries are loaded at run-time
+#include <dlfcn.h>
+
+// libXxf86vm function pointer typedefs
+typedef Bool (* XF86VIDMODEQUERYEXTENSION_T)(Display*,int*,int*);
+typedef Bool (* XF86VIDMODEGETGAMMARAMP_T)(Display*,int,int,unsigned short*,unsigned short*,unsigned short*);
+typedef Bool (* XF86VIDMODESETGAMMARAMP_T)(Display*,int,int,unsigned short*,unsigned short*,unsigned short*);
+typedef Bool (* XF86VIDMODEGETGAMMARAMPSIZE_T)(Display*,int,int*);
+
+// libXrandr function pointer typedefs
+typedef Bool (* XRRQUERYEXTENSION_T)(Display*,int*,int*);
+typedef Status (* XRRQUERYVERSION_T)(Display*,int*,int*);
+typedef void (* XRRSELECTINPUT_T)(Display*,Window,int);
+typedef int (* XRRUPDATECONFIGURATION_T)(XEvent*);
+typedef XRRScreenResources* (* XRRGETSCREENRESOURCES_T)(Display*,Window);
+typedef XRRScreenResources* (* XRRGETSCREENRESOURCESCURRENT_T)(Display*,Window);
+typedef void (* XRRFREESCREENRESOURCES_T)(XRRScreenResources*);
+typedef XRROutputInfo* (* XRRGETOUTPUTINFO_T)(Display*,XRRScreenResources*,RROutput);
+typedef void (* XRRFREEOUTPUTINFO_T)(XRROutputInfo*);
+typedef RROutput (* XRRGETOUTPUTPRIMARY_T)(Display*,Window);
+typedef XRRCrtcInfo* (* XRRGETCRTCINFO_T)(Display*,XRRScreenResources*,RRCrtc);
+typedef void (* XRRFREECRTCINFO_T)(XRRCrtcInfo*);
+typedef Status (* XRRSETCRTCCONFIG_T)(Display*,XRRScreenResources*,RRCrtc,Time,int,int,RRMode,Rotation,RROutput*,int);
+typedef int (* XRRGETCRTCGAMMASIZE_T)(Display*,RRCrtc);
+typedef XRRCrtcGamma* (* XRRGETCRTCGAMMA_T)(Display*,RRCrtc);
+typedef XRRCrtcGamma* (* XRRALLOCGAMMA_T)(int);
+typedef void (* XRRSETCRTCGAMMA_T)(Display*,RRCrtc,XRRCrtcGamma*);
+typedef void (* XRRFREEGAMMA_T)(XRRCrtcGamma*);
+#if RANDR_MAJOR > 1 || RANDR_MINOR >= 5
+typedef XRRMonitorInfo* (* XRRGETMONITORS_T)(Display*,Window,Bool,int*);
+typedef void (* XRRFREEMONITORS_T)(XRRMonitorInfo*);
+#endif
+
+// Names and locations of entry points to load from a library
+struct _GLFWentryX11
+{
+    const char* name;
+    void**      address;
+};
+
+// libXi function pointer typedefs
+typedef Status (* XIQUERYVERSION_T)(Display*,int*,int*);
+typedef int (* XISELECTEVENTS_T)(Display*,Window,XIEventMask*,int);
+
+// libXxf86vm shortcuts
+#define XF86VidModeQueryExtension _glfw.x11.vidmode.QueryExtension
+#define XF86VidModeGetGammaRamp _glfw.x11.vidmode.GetGammaRamp
+#define XF86VidModeSetGammaRamp _glfw.x11.vidmode.SetGammaRamp
+#define XF86VidModeGetGammaRampSize _glfw.x11.vidmode.GetGammaRampSize
+
+// libXrandr shortcuts
+#define XRRQueryExtension _glfw.x11.randr.QueryExtension
+#define XRRQueryVersion _glfw.x11.randr.QueryVersion
+#define XRRSelectInput _glfw.x11.randr.SelectInput
+#define XRRUpdateConfiguration _glfw.x11.randr.UpdateConfiguration
+#define XRRGetScreenResources _glfw.x11.randr.GetScreenResources
+#define XRRGetScreenResourcesCurrent _glfw.x11.randr.GetScreenResourcesCurrent
+#define XRRFreeScreenResources _glfw.x11.randr.FreeScreenResources
+#define XRRGetOutputInfo _glfw.x11.randr.GetOutputInfo
+#define XRRFreeOutputInfo _glfw.x11.randr.FreeOutputInfo
+#define XRRGetOutputPrimary _glfw.x11.randr.GetOutputPrimary
+#define XRRGetCrtcInfo _glfw.x11.randr.GetCrtcInfo
+#define XRRFreeCrtcInfo _glfw.x11.randr.FreeCrtcInfo
+#define XRRSetCrtcConfig _glfw.x11.randr.SetCrtcConfig
+#define XRRGetCrtcGammaSize _glfw.x11.randr.GetCrtcGammaSize
+#define XRRGetCrtcGamma _glfw.x11.randr.GetCrtcGamma
+#define XRRAllocGamma _glfw.x11.randr.AllocGamma
+#define XRRSetCrtcGamma _glfw.x11.randr.SetCrtcGamma
+#define XRRFreeGamma _glfw.x11.randr.FreeGamma
+#if RANDR_MAJOR > 1 || RANDR_MINOR >= 5
+ #define XRRGetMonitors _glfw.x11.randr.GetMonitors
+ #define XRRFreeMonitors _glfw.x11.randr.FreeMonitors
+#endif
+
+// libXi shortcuts
+#define XIQueryVersion _glfw.x11.xi.QueryVersion
+#define XISelectEvents _glfw.x11.xi.SelectEvents
+
 #if defined(_GLFW_GLX)
  #define _GLFW_X11_CONTEXT_VISUAL window->glx.visual
  #include "glx_platform.h"
@@ -63,6 +147,9 @@
 #define _GLFW_PLATFORM_LIBRARY_WINDOW_STATE _GLFWlibraryX11 x11
 #define _GLFW_PLATFORM_MONITOR_STATE        _GLFWmonitorX11 x11
 
+// The number of joystick samples kept per joystick
+#define _GLFW_JOYSTICK_HISTORY_SIZE 1024
+
 
 //========================================================================
 // GLFW platform specific types
@@ -90,6 +177,9 @@ typedef struct _GLFWwindowX11
     // The last position the cursor was warped to by GLFW
     int             warpPosX, warpPosY;
 
+    // Whether the window was fullscreen before the monitors were re-enumerated
+    GLboolean       wasFullscreen;
+
 } _GLFWwindowX11;
 
 
@@ -118,6 +208,8 @@ typedef struct _GLFWlibraryX11
     Atom            NET_WM_STATE_FULLSCREEN;
     Atom            NET_WM_BYPASS_COMPOSITOR;
     Atom            NET_ACTIVE_WINDOW;
+    Atom            NET_SUPPORTED;
+    Atom            NET_SUPPORTING_WM_CHECK;
     Atom            MOTIF_WM_HINTS;
 
     // Xdnd (drag and drop) atoms
@@ -151,18 +243,54 @@ typedef struct _GLFWlibraryX11
 
     struct {
         GLboolean   available;
+        void*       handle;
         int         eventBase;
         int         errorBase;
+        XF86VIDMODEQUERYEXTENSION_T QueryExtension;
+        XF86VIDMODEGETGAMMARAMP_T GetGammaRamp;
+        XF86VIDMODESETGAMMARAMP_T SetGammaRamp;
+        XF86VIDMODEGETGAMMARAMPSIZE_T GetGammaRampSize;
     } vidmode;
 
     struct {
         GLboolean   available;
+        void*       handle;
         int         eventBase;
         int         errorBase;
         int         versionMajor;
         int         versionMinor;
+        XRRQUERYEXTENSION_T QueryExtension;
+        XRRQUERYVERSION_T QueryVersion;
+        XRRSELECTINPUT_T SelectInput;
+        XRRUPDATECONFIGURATION_T UpdateConfiguration;
+        XRRGETSCREENRESOURCES_T GetScreenResources;
+        XRRGETSCREENRESOURCESCURRENT_T GetScreenResourcesCurrent;
+        XRRFREESCREENRESOURCES_T FreeScreenResources;
+        XRRGETOUTPUTINFO_T GetOutputInfo;
+        XRRFREEOUTPUTINFO_T FreeOutputInfo;
+        XRRGETOUTPUTPRIMARY_T GetOutputPrimary;
+        XRRGETCRTCINFO_T GetCrtcInfo;
+        XRRFREECRTCINFO_T FreeCrtcInfo;
+        XRRSETCRTCCONFIG_T SetCrtcConfig;
+        XRRGETCRTCGAMMASIZE_T GetCrtcGammaSize;
+        XRRGETCRTCGAMMA_T GetCrtcGamma;
+        XRRALLOCGAMMA_T AllocGamma;
+        XRRSETCRTCGAMMA_T SetCrtcGamma;
+        XRRFREEGAMMA_T FreeGamma;
+#if RANDR_MAJOR > 1 || RANDR_MINOR >= 5
+        // These are only present in RandR 1.5 and later versions of the library
+        XRRGETMONITORS_T GetMonitors;
+        XRRFREEMONITORS_T FreeMonitors;
+#endif
         GLboolean   gammaBroken;
         GLboolean   monitorBroken;
+        // Cached screen resources and the info of their CRTCs and outputs,
+        // invalidated by RandR events
+        XRRScreenResources* resources;
+        XRRCrtcInfo**   crtcInfos;
+        XRROutputInfo** outputInfos;
+        // Whether the monitors need to be re-enumerated
+        GLboolean       monitorsChanged;
     } randr;
 
     struct {
@@ -175,11 +303,14 @@ typedef struct _GLFWlibraryX11
 
     struct {
         GLboolean   available;
+        void*       handle;
         int         majorOpcode;
         int         eventBase;
         int         errorBase;
         int         versionMajor;
         int         versionMinor;
+        XIQUERYVERSION_T QueryVersion;
+        XISELECTEVENTS_T SelectEvents;
     } xi;
 
     // LUT for mapping X11 key codes to GLFW key codes
@@ -197,6 +328,9 @@ typedef struct _GLFWlibraryX11
         GLboolean   monotonic;
         double      resolution;
         uint64_t    base;
+        // Estimated offset from server timestamps to the raw timer, in seconds
+        double      serverOffset;
+        GLboolean   hasServerOffset;
     } timer;
 
     struct {
@@ -215,8 +349,56 @@ typedef struct _GLFWlibraryX11
         unsigned char* buttons;
         int         buttonCount;
         char*       name;
+        char*       path;
+#if defined(__linux__)
+        // Maps event codes to axis and button indices
+        int         keyMap[KEY_CNT - BTN_MISC];
+        int         absMap[ABS_CNT];
+        struct input_absinfo absInfo[ABS_CNT];
+        GLboolean   dropped;
+        // Whether event timestamps are from the clock used by the timer
+        GLboolean   sameClock;
+        // Position of the main thread in the history ring
+        unsigned int eventTail;
+        // Set by the sampler thread for the main thread to act on
+        int         resync;
+        int         disconnected;
+#endif
     } joystick[GLFW_JOYSTICK_LAST + 1];
 
+#if defined(__linux__)
+    // Ring of recent samples for each joystick slot, written by whichever
+    // thread is reading the joystick devices
+    struct {
+        GLFWjoysticksample samples[_GLFW_JOYSTICK_HISTORY_SIZE];
+        unsigned int head;
+        // Position of glfwGetJoystickHistory in the ring
+        unsigned int tail;
+    } joystickHistory[GLFW_JOYSTICK_LAST + 1];
+    // Guards the glfwGetJoystickHistory positions, which any thread may move
+    pthread_mutex_t historyLock;
+
+    // Optional thread reading joystick devices as events arrive
+    struct {
+        GLboolean   running;
+        int         stop;
+        pthread_t   thread;
+        pthread_mutex_t lock;
+        int         pipe[2];
+        // Written by the sampler thread to end glfwWaitEvents
+        int         notify[2];
+    } sampler;
+#endif
+
+    // Whether joystick devices have been looked for yet
+    GLboolean       joysticksDetected;
+
+    // inotify watch for joystick hotplugging
+    struct {
+        int         fd;
+        int         wd;
+    } inotify;
+
 } _GLFWlibraryX11;
 
 
@@ -228,6 +410,7 @@ typedef struct _GLFWmonitorX11
     RROutput        output;
     RRCrtc          crtc;
     RRMode          oldMode;
+    int             gammaSize; // Native gamma ramp size, or zero if unknown
 
 } _GLFWmonitorX11;
 
@@ -238,6 +421,8 @@ typedef struct _GLFWmonitorX11
 
 // Time
 void _glfwInitTimer(void);
+double _glfwTranslateServerTime(Time time);
+double _glfwTranslateKernelTime(long sec, long usec);
 
 // Gamma
 void _glfwInitGammaRamp(void);
@@ -245,10 +430,13 @@ void _glfwInitGammaRamp(void);
 // Fullscreen support
 GLboolean _glfwSetVideoMode(_GLFWmonitor* monitor, const GLFWvidmode* desired);
 void _glfwRestoreVideoMode(_GLFWmonitor* monitor);
+void _glfwInvalidateMonitorCache(void);
+RRCrtc _glfwGetMonitorCrtc(_GLFWmonitor* monitor);
 
 // Joystick input
 void _glfwInitJoysticks(void);
 void _glfwTerminateJoysticks(void);
+void _glfwPollJoystickEvents(void);
 
 // Unicode support
 long _glfwKeySym2Unicode(KeySym keysym);
@@ -29,6 +29,7 @@
 
 #include <sys/time.h>
 #include <time.h>
+#include <errno.h>
 
 
 // Return raw time
@@ -79,6 +80,53 @@ void _glfwInitTimer(void)
     _glfw.x11.timer.base = getRawTime();
 }
 
+// Translate an X server timestamp to the time base of glfwGetTime
+//
+double _glfwTranslateServerTime(Time time)
+{
+    double offset;
+
+    // Synthetic events may not carry a timestamp
+    if (time == CurrentTime)
+        return _glfwPlatformGetTime();
+
+    // The server clock runs at the same rate as ours but from an unknown
+    // origin, and each event reaches us some time after it was stamped, so
+    // the smallest difference seen so far is the best estimate of the offset
+    offset = (double) getRawTime() * _glfw.x11.timer.resolution -
+             (double) time / 1000.0;
+
+    // A much larger difference means the 32-bit millisecond server clock
+    // has wrapped around or one of the clocks was reset
+    if (!_glfw.x11.timer.hasServerOffset ||
+        offset < _glfw.x11.timer.serverOffset ||
+        offset - _glfw.x11.timer.serverOffset > 60.0)
+    {
+        _glfw.x11.timer.serverOffset = offset;
+        _glfw.x11.timer.hasServerOffset = GL_TRUE;
+    }
+
+    return (double) time / 1000.0 + _glfw.x11.timer.serverOffset -
+           (double) _glfw.x11.timer.base * _glfw.x11.timer.resolution;
+}
+
+// Translate a kernel timestamp to the time base of glfwGetTime
+// The timestamp must be from the clock used by the timer
+//
+double _glfwTranslateKernelTime(long sec, long usec)
+{
+    uint64_t time;
+
+    if (_glfw.x11.timer.monotonic)
+        time = (uint64_t) sec * (uint64_t) 1000000000 + (uint64_t) usec * 1000;
+    else
+        time = (uint64_t) sec * (uint64_t) 1000000 + (uint64_t) usec;
+
+    // The event may predate the timer base
+    return (double) (int64_t) (time - _glfw.x11.timer.base) *
+        _glfw.x11.timer.resolution;
+}
+
 
 //////////////////////////////////////////////////////////////////////////
 //////                       GLFW platform API                      //////
@@ -96,3 +144,15 @@ void _glfwPlatformSetTime(double time)
         (uint64_t) (time / _glfw.x11.timer.resolution);
 }
 
+void _glfwPlatformSleep(double seconds)
+{
+    struct timespec ts;
+
+    ts.tv_sec = (time_t) seconds;
+    ts.tv_nsec = (long) ((seconds - (double) ts.tv_sec) * 1e9);
+
+    // Continue sleeping for the remaining time if interrupted by a signal
+    while (nanosleep(&ts, &ts) == -1 && errno == EINTR)
+        ;
+}
+
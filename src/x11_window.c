@@ -362,9 +362,6 @@ static GLboolean createWindow(_GLFWwindow* window,
 
     _glfwPlatformSetWindowTitle(window, wndconfig->title);
 
-    XRRSelectInput(_glfw.x11.display, window->x11.handle,
-                   RRScreenChangeNotifyMask);
-
     _glfwPlatformGetWindowPos(window, &window->x11.xpos, &window->x11.ypos);
     _glfwPlatformGetWindowSize(window, &window->x11.width, &window->x11.height);
 
@@ -417,7 +414,13 @@ static void enterFullscreenMode(_GLFWwindow* window)
 
     _glfw.x11.saver.count++;
 
-    _glfwSetVideoMode(window->monitor, &window->videoMode);
+    if (window->borderless)
+    {
+        // Cover the monitor at whatever mode it is already using
+        _glfwPlatformGetVideoMode(window->monitor, &window->videoMode);
+    }
+    else
+        _glfwSetVideoMode(window->monitor, &window->videoMode);
 
     if (_glfw.x11.NET_WM_BYPASS_COMPOSITOR)
     {
@@ -500,7 +503,8 @@ static void enterFullscreenMode(_GLFWwindow* window)
 //
 static void leaveFullscreenMode(_GLFWwindow* window)
 {
-    _glfwRestoreVideoMode(window->monitor);
+    if (!window->borderless)
+        _glfwRestoreVideoMode(window->monitor);
 
     _glfw.x11.saver.count--;
 
@@ -549,12 +553,61 @@ static void leaveFullscreenMode(_GLFWwindow* window)
 }
 
 
+// Re-enumerates the monitors and moves fullscreen windows off of
+// disconnected monitors
+//
+static void handleMonitorChange(void)
+{
+    _GLFWwindow* window;
+
+    // Windows on disconnected monitors are made windowed by the shared code,
+    // so remember which were fullscreen
+    for (window = _glfw.windowListHead;  window;  window = window->next)
+        window->x11.wasFullscreen = (window->monitor != NULL);
+
+    _glfwInputMonitorChange();
+
+    for (window = _glfw.windowListHead;  window;  window = window->next)
+    {
+        if (!window->x11.wasFullscreen || window->monitor)
+            continue;
+
+        window->x11.wasFullscreen = GL_FALSE;
+
+        // Move the window to the primary monitor, as its video mode can no
+        // longer be restored on the disconnected one
+        window->monitor = _glfw.monitors[0];
+        leaveFullscreenMode(window);
+        enterFullscreenMode(window);
+    }
+}
+
 // Process the specified X event
 //
 static void processEvent(XEvent *event)
 {
     _GLFWwindow* window = NULL;
 
+    if (_glfw.x11.randr.available)
+    {
+        // RandR events are also delivered for the root window
+        // Monitors are re-enumerated once all pending events are processed
+        if (event->type == _glfw.x11.randr.eventBase + RRScreenChangeNotify)
+        {
+            XRRUpdateConfiguration(event);
+            _glfwInvalidateMonitorCache();
+            _glfw.x11.randr.monitorsChanged = GL_TRUE;
+            return;
+        }
+
+        if (event->type == _glfw.x11.randr.eventBase + RRNotify)
+        {
+            _glfwInvalidateMonitorCache();
+            _glfw.x11.randr.monitorsChanged = GL_TRUE;
+            return;
+        }
+    }
+
     if (event->type != GenericEvent)
     {
         window = _glfwFindWindowByHandle(event->xany.window);
@@ -696,7 +749,8 @@ static void processEvent(XEvent *event)
                     y = event->xmotion.y;
                 }
 
-                _glfwInputCursorMotion(window, x, y);
+                _glfwInputCursorMotion(window, x, y,
+                                       _glfwTranslateServerTime(event->xmotion.time));
             }
 
             window->x11.cursorPosX = event->xmotion.x;
@@ -790,7 +844,8 @@ static void processEvent(XEvent *event)
                 int x, y;
 
                 _glfwPlatformGetWindowPos(window, &x, &y);
-                _glfwInputCursorMotion(window, absX - x, absY - y);
+                _glfwInputCursorMotion(window, absX - x, absY - y,
+                                       _glfwTranslateServerTime(event->xclient.data.l[3]));
 
                 // Reply that we are ready to copy the dragged data
                 XEvent reply;
@@ -973,7 +1028,8 @@ static void processEvent(XEvent *event)
                                 y = data->event_y;
                             }
 
-                            _glfwInputCursorMotion(window, x, y);
+                            _glfwInputCursorMotion(window, x, y,
+                                                   _glfwTranslateServerTime(data->time));
                         }
 
                         window->x11.cursorPosX = data->event_x;
@@ -985,20 +1041,6 @@ static void processEvent(XEvent *event)
             XFreeEventData(_glfw.x11.display, &event->xcookie);
             break;
         }
-
-        default:
-        {
-            switch (event->type - _glfw.x11.randr.eventBase)
-            {
-                case RRScreenChangeNotify:
-                {
-                    XRRUpdateConfiguration(event);
-                    break;
-                }
-            }
-
-            break;
-        }
     }
 }
 
@@ -1190,7 +1232,8 @@ void _glfwPlatformSetWindowSize(_GLFWwindow* window, int width, int height)
 {
     if (window->monitor)
     {
-        _glfwSetVideoMode(window->monitor, &window->videoMode);
+        if (!window->borderless)
+            _glfwSetVideoMode(window->monitor, &window->videoMode);
 
         if (window->x11.overrideRedirect)
         {
@@ -1279,6 +1322,14 @@ void _glfwPlatformPollEvents(void)
         processEvent(&event);
     }
 
+    if (_glfw.x11.randr.monitorsChanged)
+    {
+        _glfw.x11.randr.monitorsChanged = GL_FALSE;
+        handleMonitorChange();
+    }
+
+    _glfwPollJoystickEvents();
+
     _GLFWwindow* window = _glfw.focusedWindow;
     if (window && window->cursorMode == GLFW_CURSOR_DISABLED)
     {
@@ -1293,15 +1344,48 @@ void _glfwPlatformWaitEvents(void)
     if (!XPending(_glfw.x11.display))
     {
         fd_set fds;
-        const int fd = ConnectionNumber(_glfw.x11.display);
+        int count = ConnectionNumber(_glfw.x11.display) + 1;
 
         FD_ZERO(&fds);
-        FD_SET(fd, &fds);
+        FD_SET(ConnectionNumber(_glfw.x11.display), &fds);
+
+#if defined(__linux__)
+        int i;
+
+        // Joystick input and hotplugging also end the wait
+        if (_glfw.x11.sampler.running)
+        {
+            // The sampler thread drains the joystick devices and notifies us
+            // once it has recorded their input
+            FD_SET(_glfw.x11.sampler.notify[0], &fds);
+            if (_glfw.x11.sampler.notify[0] >= count)
+                count = _glfw.x11.sampler.notify[0] + 1;
+        }
+        else
+        {
+            for (i = 0;  i <= GLFW_JOYSTICK_LAST;  i++)
+            {
+                if (!_glfw.x11.joystick[i].present)
+                    continue;
+
+                FD_SET(_glfw.x11.joystick[i].fd, &fds);
+                if (_glfw.x11.joystick[i].fd >= count)
+                    count = _glfw.x11.joystick[i].fd + 1;
+            }
+        }
+
+        if (_glfw.x11.inotify.fd > 0)
+        {
+            FD_SET(_glfw.x11.inotify.fd, &fds);
+            if (_glfw.x11.inotify.fd >= count)
+                count = _glfw.x11.inotify.fd + 1;
+        }
+#endif
 
         // select(1) is used instead of an X function like XNextEvent, as the
         // wait inside those are guarded by the mutex protecting the display
         // struct, locking out other threads from using X (including GLX)
-        if (select(fd + 1, &fds, NULL, NULL, NULL) < 0)
+        if (select(count, &fds, NULL, NULL, NULL) < 0)
             return;
     }
 
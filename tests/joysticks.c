@@ -61,6 +61,30 @@ static void framebuffer_size_callback(GLFWwindow* window, int width, int height)
     glViewport(0, 0, width, height);
 }
 
+static void joystick_callback(int joy, int event)
+{
+    printf("%0.3f: Joystick %i was %s\n",
+           glfwGetTime(),
+           joy + 1,
+           event == GLFW_CONNECTED ? "connected" : "disconnected");
+}
+
+static void joystick_input_callback(int joy, int type, int index, float value, double time)
+{
+    if (type == GLFW_JOYSTICK_BUTTON)
+    {
+        printf("%0.3f: Joystick %i button %i was %s (at %0.3f)\n",
+               glfwGetTime(), joy + 1, index,
+               value == GLFW_PRESS ? "pressed" : "released",
+               time);
+    }
+    else
+    {
+        printf("%0.3f: Joystick %i axis %i moved to %0.3f (at %0.3f)\n",
+               glfwGetTime(), joy + 1, index, value, time);
+    }
+}
+
 static void draw_joystick(Joystick* j, int x, int y, int width, int height)
 {
     int i;
@@ -205,6 +229,9 @@ int main(void)
     if (!glfwInit())
         exit(EXIT_FAILURE);
 
+    glfwSetJoystickCallback(joystick_callback);
+    glfwSetJoystickInputCallback(joystick_input_callback);
+
     window = glfwCreateWindow(640, 480, "Joystick Test", NULL, NULL);
     if (!window)
     {
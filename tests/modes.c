@@ -82,7 +82,7 @@ static void key_callback(GLFWwindow* window, int key, int scancode, int action,
 
 static void list_modes(GLFWmonitor* monitor)
 {
-    int count, x, y, widthMM, heightMM, dpi, i;
+    int count, x, y, widthMM, heightMM, dpi, i, num, den;
     const GLFWvidmode* mode = glfwGetVideoMode(monitor);
     const GLFWvidmode* modes = glfwGetVideoModes(monitor, &count);
 
@@ -93,6 +93,11 @@ static void list_modes(GLFWmonitor* monitor)
            glfwGetMonitorName(monitor),
            glfwGetPrimaryMonitor() == monitor ? "primary" : "secondary");
     printf("Current mode: %s\n", format_mode(mode));
+
+    glfwGetVideoModeRefreshRational(monitor, &num, &den);
+    if (num)
+        printf("Exact refresh rate: %i/%i Hz (%0.3f Hz)\n", num, den, (double) num / den);
+
     printf("Virtual position: %i %i\n", x, y);
 
     dpi = (int) ((float) mode->width * 25.4f / (float) widthMM);
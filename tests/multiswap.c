@@ -0,0 +1,147 @@
+//========================================================================
+// Multi-window swap test
+// Copyright (c) Camilla Berglund <elmindreda@elmindreda.org>
+//
+// This software is provided 'as-is', without any express or implied
+// warranty. In no event will the authors be held liable for any damages
+// arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it
+// freely, subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented; you must not
+//    claim that you wrote the original software. If you use this software
+//    in a product, an acknowledgment in the product documentation would
+//    be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such, and must not
+//    be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source
+//    distribution.
+//
+//========================================================================
+//
+// This test measures the frame rate of an increasing number of vsynced
+// windows, swapping them one by one with glfwSwapBuffers and all at once
+// with glfwSwapBuffersMulti
+//
+//========================================================================
+
+#include <GLFW/glfw3.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "getopt.h"
+
+#define MAX_WINDOWS 16
+
+static GLFWwindow* windows[MAX_WINDOWS];
+
+static void usage(void)
+{
+    printf("Usage: multiswap [-n WINDOWS] [-f FRAMES]\n");
+    printf("       multiswap -h\n");
+}
+
+static void error_callback(int error, const char* description)
+{
+    fprintf(stderr, "Error: %s\n", description);
+}
+
+static double measure(int window_count, int frame_count, GLboolean batched)
+{
+    int i, j;
+    const double start = glfwGetTime();
+
+    for (i = 0;  i < frame_count;  i++)
+    {
+        for (j = 0;  j < window_count;  j++)
+        {
+            glfwMakeContextCurrent(windows[j]);
+            glClearColor((GLclampf) (i & 1), (GLclampf) (j & 1), 0.f, 0.f);
+            glClear(GL_COLOR_BUFFER_BIT);
+
+            if (!batched)
+                glfwSwapBuffers(windows[j]);
+        }
+
+        if (batched)
+        {
+            // Making no context current flushes the last window's rendering
+            glfwMakeContextCurrent(NULL);
+            glfwSwapBuffersMulti(windows, window_count);
+        }
+
+        glfwPollEvents();
+    }
+
+    return frame_count / (glfwGetTime() - start);
+}
+
+int main(int argc, char** argv)
+{
+    int i, ch, window_count = 8, frame_count = 120;
+
+    while ((ch = getopt(argc, argv, "f:hn:")) != -1)
+    {
+        switch (ch)
+        {
+            case 'f':
+                frame_count = atoi(optarg);
+                break;
+            case 'h':
+                usage();
+                exit(EXIT_SUCCESS);
+            case 'n':
+                window_count = atoi(optarg);
+                break;
+            default:
+                usage();
+                exit(EXIT_FAILURE);
+        }
+    }
+
+    if (window_count < 1 || window_count > MAX_WINDOWS || frame_count < 1)
+    {
+        usage();
+        exit(EXIT_FAILURE);
+    }
+
+    glfwSetErrorCallback(error_callback);
+
+    if (!glfwInit())
+        exit(EXIT_FAILURE);
+
+    for (i = 0;  i < window_count;  i++)
+    {
+        double sequential, batched;
+
+        windows[i] = glfwCreateWindow(160, 120, "Multi-Window Swap Test",
+                                      NULL, NULL);
+        if (!windows[i])
+        {
+            glfwTerminate();
+            exit(EXIT_FAILURE);
+        }
+
+        glfwSetWindowPos(windows[i], 50 + (i % 4) * 200, 50 + (i / 4) * 170);
+
+        // The interval is set only once, so the sequential runs show whether
+        // the batched runs preserve it
+        glfwMakeContextCurrent(windows[i]);
+        glfwSwapInterval(1);
+
+        sequential = measure(i + 1, frame_count, GL_FALSE);
+        batched = measure(i + 1, frame_count, GL_TRUE);
+
+        printf("%2i windows: %6.1f fps swapping one by one, %6.1f fps batched\n",
+               i + 1, sequential, batched);
+    }
+
+    glfwTerminate();
+    exit(EXIT_SUCCESS);
+}
+
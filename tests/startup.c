@@ -0,0 +1,186 @@
+//========================================================================
+// Startup time benchmark
+// Copyright (c) Camilla Berglund <elmindreda@elmindreda.org>
+//
+// This software is provided 'as-is', without any express or implied
+// warranty. In no event will the authors be held liable for any damages
+// arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it
+// freely, subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented; you must not
+//    claim that you wrote the original software. If you use this software
+//    in a product, an acknowledgment in the product documentation would
+//    be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such, and must not
+//    be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source
+//    distribution.
+//
+//========================================================================
+//
+// This test measures how long it takes to initialize GLFW, query the
+// monitors, create a hidden window, process its first events and terminate
+// GLFW again
+//
+// It approximates the startup cost paid by short-lived tools, and the monitor
+// queries are most telling on systems with many monitors, such as video walls
+//
+//========================================================================
+
+#include "tinycthread.h"
+
+#include <GLFW/glfw3.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "getopt.h"
+
+enum Stage
+{
+    STAGE_INIT,
+    STAGE_MONITORS,
+    STAGE_WINDOW,
+    STAGE_EVENTS,
+    STAGE_TERMINATE,
+    STAGE_COUNT
+};
+
+static const char* stage_names[STAGE_COUNT] =
+{
+    "glfwInit",
+    "monitor queries",
+    "glfwCreateWindow",
+    "glfwPollEvents",
+    "glfwTerminate"
+};
+
+static void usage(void)
+{
+    printf("Usage: startup [-n COUNT]\n");
+    printf("       startup -h\n");
+}
+
+static void error_callback(int error, const char* description)
+{
+    fprintf(stderr, "Error: %s\n", description);
+}
+
+static double get_seconds(void)
+{
+    struct timespec time;
+    clock_gettime(CLOCK_REALTIME, &time);
+    return (double) time.tv_sec + (double) time.tv_nsec / 1e9;
+}
+
+int main(int argc, char** argv)
+{
+    int i, j, ch, stage, count = 0, iterations = 20;
+    double times[STAGE_COUNT + 1];
+    double total[STAGE_COUNT], fastest[STAGE_COUNT], slowest[STAGE_COUNT];
+    GLFWwindow* window;
+    GLFWmonitor** monitors;
+
+    while ((ch = getopt(argc, argv, "hn:")) != -1)
+    {
+        switch (ch)
+        {
+            case 'h':
+                usage();
+                exit(EXIT_SUCCESS);
+            case 'n':
+                iterations = atoi(optarg);
+                break;
+            default:
+                usage();
+                exit(EXIT_FAILURE);
+        }
+    }
+
+    if (iterations < 1)
+    {
+        usage();
+        exit(EXIT_FAILURE);
+    }
+
+    glfwSetErrorCallback(error_callback);
+
+    for (i = 0;  i < iterations;  i++)
+    {
+        times[STAGE_INIT] = get_seconds();
+
+        if (!glfwInit())
+            exit(EXIT_FAILURE);
+
+        times[STAGE_MONITORS] = get_seconds();
+
+        monitors = glfwGetMonitors(&count);
+
+        for (j = 0;  j < count;  j++)
+        {
+            int xpos, ypos;
+
+            glfwGetMonitorPos(monitors[j], &xpos, &ypos);
+            glfwGetVideoMode(monitors[j]);
+        }
+
+        times[STAGE_WINDOW] = get_seconds();
+
+        glfwWindowHint(GLFW_VISIBLE, GL_FALSE);
+
+        window = glfwCreateWindow(200, 200, "Startup", NULL, NULL);
+        if (!window)
+        {
+            glfwTerminate();
+            exit(EXIT_FAILURE);
+        }
+
+        times[STAGE_EVENTS] = get_seconds();
+
+        glfwPollEvents();
+
+        times[STAGE_TERMINATE] = get_seconds();
+
+        glfwTerminate();
+
+        times[STAGE_COUNT] = get_seconds();
+
+        for (stage = 0;  stage < STAGE_COUNT;  stage++)
+        {
+            const double elapsed = times[stage + 1] - times[stage];
+
+            if (i == 0)
+            {
+                total[stage] = 0.0;
+                fastest[stage] = elapsed;
+                slowest[stage] = elapsed;
+            }
+
+            total[stage] += elapsed;
+
+            if (elapsed < fastest[stage])
+                fastest[stage] = elapsed;
+            if (elapsed > slowest[stage])
+                slowest[stage] = elapsed;
+        }
+    }
+
+    printf("%i monitors\n", count);
+
+    for (stage = 0;  stage < STAGE_COUNT;  stage++)
+    {
+        printf("%-16s %0.3f ms average, %0.3f ms min, %0.3f ms max\n",
+               stage_names[stage],
+               total[stage] / iterations * 1000.0,
+               fastest[stage] * 1000.0,
+               slowest[stage] * 1000.0);
+    }
+
+    exit(EXIT_SUCCESS);
+}
+
@@ -26,6 +26,9 @@
 // This test is intended to verify whether the OpenGL context part of
 // the GLFW API is able to be used from multiple threads
 //
+// With -p it instead measures the cost of switching back and forth between
+// two contexts, with each of the context release behaviors
+//
 //========================================================================
 
 #include "tinycthread.h"
@@ -36,6 +39,8 @@
 #include <stdlib.h>
 #include <math.h>
 
+#include "getopt.h"
+
 typedef struct
 {
     GLFWwindow* window;
@@ -46,11 +51,81 @@ typedef struct
 
 static volatile GLboolean running = GL_TRUE;
 
+static void usage(void)
+{
+    printf("Usage: threads [-p] [-n COUNT]\n");
+    printf("       threads -h\n");
+}
+
 static void error_callback(int error, const char* description)
 {
     fprintf(stderr, "Error: %s\n", description);
 }
 
+static const char* get_release_name(int behavior)
+{
+    if (behavior == GLFW_RELEASE_BEHAVIOR_FLUSH)
+        return "flush";
+    if (behavior == GLFW_RELEASE_BEHAVIOR_NONE)
+        return "none";
+
+    return "unknown";
+}
+
+static void ping_pong(int switch_count)
+{
+    int i, j;
+    double start, elapsed;
+    const int behaviors[] =
+    {
+        GLFW_RELEASE_BEHAVIOR_FLUSH,
+        GLFW_RELEASE_BEHAVIOR_NONE
+    };
+    const int count = sizeof(behaviors) / sizeof(int);
+
+    glfwWindowHint(GLFW_VISIBLE, GL_FALSE);
+
+    for (i = 0;  i < count;  i++)
+    {
+        GLFWwindow* windows[2];
+
+        glfwWindowHint(GLFW_CONTEXT_RELEASE_BEHAVIOR, behaviors[i]);
+
+        windows[0] = glfwCreateWindow(64, 64, "Ping", NULL, NULL);
+        windows[1] = glfwCreateWindow(64, 64, "Pong", NULL, windows[0]);
+        if (!windows[0] || !windows[1])
+        {
+            glfwTerminate();
+            exit(EXIT_FAILURE);
+        }
+
+        start = glfwGetTime();
+
+        // Each switch leaves a command pending for the release to flush
+        for (j = 0;  j < switch_count;  j++)
+        {
+            glfwMakeContextCurrent(windows[j & 1]);
+            glClear(GL_COLOR_BUFFER_BIT);
+        }
+
+        glfwMakeContextCurrent(NULL);
+
+        elapsed = glfwGetTime() - start;
+
+        printf("Release behavior %s (got %s): %i switches in %0.3f ms (%0.3f us per switch)\n",
+               get_release_name(behaviors[i]),
+               get_release_name(glfwGetWindowAttrib(windows[0],
+                                                    GLFW_CONTEXT_RELEASE_BEHAVIOR)),
+               switch_count, elapsed * 1000.0,
+               elapsed * 1000000.0 / switch_count);
+
+        glfwDestroyWindow(windows[0]);
+        glfwDestroyWindow(windows[1]);
+    }
+
+    glfwDefaultWindowHints();
+}
+
 static int thread_main(void* data)
 {
     const Thread* thread = (const Thread*) data;
@@ -71,9 +146,10 @@ static int thread_main(void* data)
     return 0;
 }
 
-int main(void)
+int main(int argc, char** argv)
 {
-    int i, result;
+    int i, ch, result, switch_count = 10000;
+    GLboolean benchmark = GL_FALSE;
     Thread threads[] =
     {
         { NULL, "Red", 1.f, 0.f, 0.f, 0 },
@@ -82,11 +158,44 @@ int main(void)
     };
     const int count = sizeof(threads) / sizeof(Thread);
 
+    while ((ch = getopt(argc, argv, "hn:p")) != -1)
+    {
+        switch (ch)
+        {
+            case 'h':
+                usage();
+                exit(EXIT_SUCCESS);
+            case 'n':
+                switch_count = atoi(optarg);
+                break;
+            case 'p':
+                benchmark = GL_TRUE;
+                break;
+            default:
+                usage();
+                exit(EXIT_FAILURE);
+        }
+    }
+
+    if (switch_count < 1)
+    {
+        usage();
+        exit(EXIT_FAILURE);
+    }
+
     glfwSetErrorCallback(error_callback);
 
     if (!glfwInit())
         exit(EXIT_FAILURE);
 
+    if (benchmark)
+    {
+        ping_pong(switch_count);
+
+        glfwTerminate();
+        exit(EXIT_SUCCESS);
+    }
+
     glfwWindowHint(GLFW_VISIBLE, GL_FALSE);
 
     for (i = 0;  i < count;  i++)
@@ -0,0 +1,227 @@
+//========================================================================
+// Offscreen context upload test
+// Copyright (c) Camilla Berglund <elmindreda@elmindreda.org>
+//
+// This software is provided 'as-is', without any express or implied
+// warranty. In no event will the authors be held liable for any damages
+// arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it
+// freely, subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented; you must not
+//    claim that you wrote the original software. If you use this software
+//    in a product, an acknowledgment in the product documentation would
+//    be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such, and must not
+//    be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source
+//    distribution.
+//
+//========================================================================
+//
+// This test uploads textures from several threads, each using an offscreen
+// context sharing objects with a window, and measures the upload throughput
+//
+// It then verifies that the uploaded textures are visible to the window
+//
+//========================================================================
+
+#include "tinycthread.h"
+
+#include <GLFW/glfw3.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "getopt.h"
+
+#define MAX_THREADS 16
+
+typedef struct
+{
+    GLFWwindow* context;
+    GLuint* textures;
+    double elapsed;
+    thrd_t id;
+} Thread;
+
+static int texture_size = 512;
+static int texture_count = 32;
+static unsigned char* pixels;
+
+static void usage(void)
+{
+    printf("Usage: upload [-n THREADS] [-c COUNT] [-s SIZE]\n");
+    printf("       upload -h\n");
+}
+
+static void error_callback(int error, const char* description)
+{
+    fprintf(stderr, "Error: %s\n", description);
+}
+
+static int thread_main(void* data)
+{
+    int i;
+    double start;
+    Thread* thread = (Thread*) data;
+
+    glfwMakeContextCurrent(thread->context);
+
+    start = glfwGetTime();
+
+    glGenTextures(texture_count, thread->textures);
+
+    for (i = 0;  i < texture_count;  i++)
+    {
+        glBindTexture(GL_TEXTURE_2D, thread->textures[i]);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+        glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, texture_size, texture_size, 0,
+                     GL_RGBA, GL_UNSIGNED_BYTE, pixels);
+    }
+
+    // The uploads are only complete, and visible to other contexts, once they
+    // have finished executing
+    glFinish();
+
+    thread->elapsed = glfwGetTime() - start;
+
+    glfwMakeContextCurrent(NULL);
+    return 0;
+}
+
+int main(int argc, char** argv)
+{
+    int i, j, ch, result, thread_count = 4, missing = 0;
+    double start, elapsed, megabytes;
+    GLFWwindow* window;
+    Thread threads[MAX_THREADS];
+
+    while ((ch = getopt(argc, argv, "c:hn:s:")) != -1)
+    {
+        switch (ch)
+        {
+            case 'c':
+                texture_count = atoi(optarg);
+                break;
+            case 'h':
+                usage();
+                exit(EXIT_SUCCESS);
+            case 'n':
+                thread_count = atoi(optarg);
+                break;
+            case 's':
+                texture_size = atoi(optarg);
+                break;
+            default:
+                usage();
+                exit(EXIT_FAILURE);
+        }
+    }
+
+    if (thread_count < 1 || thread_count > MAX_THREADS ||
+        texture_count < 1 || texture_size < 1)
+    {
+        usage();
+        exit(EXIT_FAILURE);
+    }
+
+    glfwSetErrorCallback(error_callback);
+
+    if (!glfwInit())
+        exit(EXIT_FAILURE);
+
+    glfwWindowHint(GLFW_VISIBLE, GL_FALSE);
+
+    window = glfwCreateWindow(64, 64, "Upload Test", NULL, NULL);
+    if (!window)
+    {
+        glfwTerminate();
+        exit(EXIT_FAILURE);
+    }
+
+    start = glfwGetTime();
+
+    for (i = 0;  i < thread_count;  i++)
+    {
+        threads[i].context = glfwCreateOffscreenContext(window);
+        if (!threads[i].context)
+        {
+            glfwTerminate();
+            exit(EXIT_FAILURE);
+        }
+
+        threads[i].textures = calloc(texture_count, sizeof(GLuint));
+    }
+
+    printf("Created %i offscreen contexts in %0.3f ms\n",
+           thread_count, (glfwGetTime() - start) * 1000.0);
+
+    pixels = calloc(texture_size * texture_size, 4);
+    for (i = 0;  i < texture_size * texture_size * 4;  i++)
+        pixels[i] = (unsigned char) (rand() & 255);
+
+    start = glfwGetTime();
+
+    for (i = 0;  i < thread_count;  i++)
+    {
+        if (thrd_create(&threads[i].id, thread_main, threads + i) !=
+            thrd_success)
+        {
+            fprintf(stderr, "Failed to create secondary thread\n");
+
+            glfwTerminate();
+            exit(EXIT_FAILURE);
+        }
+    }
+
+    for (i = 0;  i < thread_count;  i++)
+        thrd_join(threads[i].id, &result);
+
+    elapsed = glfwGetTime() - start;
+    megabytes = (double) texture_size * texture_size * 4 *
+                texture_count * thread_count / (1024.0 * 1024.0);
+
+    for (i = 0;  i < thread_count;  i++)
+    {
+        printf("Thread %i uploaded %i textures in %0.3f ms\n",
+               i, texture_count, threads[i].elapsed * 1000.0);
+    }
+
+    printf("Uploaded %0.1f MiB with %i threads in %0.3f ms (%0.1f MiB/s)\n",
+           megabytes, thread_count, elapsed * 1000.0, megabytes / elapsed);
+
+    // Verify that every texture is visible to the window's context
+
+    glfwMakeContextCurrent(window);
+
+    for (i = 0;  i < thread_count;  i++)
+    {
+        for (j = 0;  j < texture_count;  j++)
+        {
+            if (!glIsTexture(threads[i].textures[j]))
+                missing++;
+        }
+    }
+
+    if (missing)
+        printf("%i textures are not visible to the window\n", missing);
+    else
+        printf("All textures are visible to the window\n");
+
+    for (i = 0;  i < thread_count;  i++)
+    {
+        glfwDestroyWindow(threads[i].context);
+        free(threads[i].textures);
+    }
+
+    free(pixels);
+
+    glfwTerminate();
+    exit(missing ? EXIT_FAILURE : EXIT_SUCCESS);
+}
+